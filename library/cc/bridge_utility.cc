@@ -3,6 +3,7 @@
 #include <sstream>
 
 #include "library/common/data/utility.h"
+#include "library/common/http/interned_headers.h"
 
 namespace Envoy {
 namespace Platform {
@@ -16,12 +17,14 @@ envoy_headers rawHeaderMapAsEnvoyHeaders(const RawHeaderMap& headers) {
   envoy_map_entry* headers_list =
       static_cast<envoy_map_entry*>(safe_malloc(sizeof(envoy_map_entry) * header_count));
 
+  const auto& interned_headers = Http::InternedHeaders::get();
   size_t i = 0;
   for (const auto& pair : headers) {
     const auto& key = pair.first;
+    const envoy_data* interned_key = interned_headers.find(key);
     for (const auto& value : pair.second) {
       envoy_map_entry& header = headers_list[i++];
-      header.key = Data::Utility::copyToBridgeData(key);
+      header.key = interned_key ? *interned_key : Data::Utility::copyToBridgeData(key);
       header.value = Data::Utility::copyToBridgeData(value);
     }
   }
@@ -75,6 +75,16 @@ EngineBuilder& EngineBuilder::addVirtualClusters(const std::string& virtual_clus
   return *this;
 }
 
+EngineBuilder& EngineBuilder::addWorkerCount(int worker_count) {
+  this->worker_count_ = worker_count;
+  return *this;
+}
+
+EngineBuilder& EngineBuilder::enableFastStart(bool fast_start) {
+  this->fast_start_ = fast_start;
+  return *this;
+}
+
 EngineSharedPtr EngineBuilder::build() {
   std::vector<std::pair<std::string, std::string>> replacements{
       {"{{ app_id }}", this->app_id_},
@@ -116,8 +126,10 @@ EngineSharedPtr EngineBuilder::build() {
       .context = this->callbacks_.get(),
   };
 
-  Engine* engine =
-      new Engine(init_engine(envoy_callbacks, null_logger), config_str, this->log_level_);
+  envoy_engine_t handle = init_engine(envoy_callbacks, null_logger);
+  set_engine_worker_count(handle, this->worker_count_);
+  set_engine_fast_start(handle, this->fast_start_);
+  Engine* engine = new Engine(handle, config_str, this->log_level_);
   return EngineSharedPtr(engine);
 }
 
@@ -25,6 +25,8 @@ public:
   EngineBuilder& setAppVersion(const std::string& app_version);
   EngineBuilder& setAppId(const std::string& app_id);
   EngineBuilder& addVirtualClusters(const std::string& virtual_clusters);
+  EngineBuilder& addWorkerCount(int worker_count);
+  EngineBuilder& enableFastStart(bool fast_start);
 
   EngineSharedPtr build();
 
@@ -48,6 +50,8 @@ private:
   std::string app_version_ = "unspecified";
   std::string app_id_ = "unspecified";
   std::string virtual_clusters_ = "[]";
+  int worker_count_ = 1;
+  bool fast_start_ = false;
 
   // TODO(crockeo): add after filter integration
   // private var platformFilterChain = mutableListOf<EnvoyHTTPFilterFactory>()
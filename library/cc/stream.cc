@@ -12,25 +12,120 @@ namespace Platform {
 Stream::Stream(envoy_stream_t handle, StreamCallbacksSharedPtr callbacks)
     : handle_(handle), callbacks_(callbacks) {}
 
+Stream::~Stream() { this->flushBatch(); }
+
 Stream& Stream::sendHeaders(RequestHeadersSharedPtr headers, bool end_stream) {
-  envoy_headers raw_headers = rawHeaderMapAsEnvoyHeaders(headers->allHeaders());
-  ::send_headers(this->handle_, raw_headers, end_stream);
+  envoy_stream_operation operation{};
+  operation.type = ENVOY_STREAM_OP_HEADERS;
+  operation.headers = rawHeaderMapAsEnvoyHeaders(headers->allHeaders());
+  operation.end_stream = end_stream;
+  this->submit(operation);
   return *this;
 }
 
 Stream& Stream::sendData(envoy_data data) {
-  ::send_data(this->handle_, data, false);
+  envoy_stream_operation operation{};
+  operation.type = ENVOY_STREAM_OP_DATA;
+  operation.data = data;
+  this->submit(operation);
+  return *this;
+}
+
+Stream& Stream::sendData(envoy_data_vector data) {
+  envoy_stream_operation operation{};
+  operation.type = ENVOY_STREAM_OP_DATA_VECTOR;
+  operation.data_vector = data;
+  this->submit(operation);
   return *this;
 }
 
 void Stream::close(RequestTrailersSharedPtr trailers) {
-  envoy_headers raw_headers = rawHeaderMapAsEnvoyHeaders(trailers->allHeaders());
-  ::send_trailers(this->handle_, raw_headers);
+  envoy_stream_operation operation{};
+  operation.type = ENVOY_STREAM_OP_TRAILERS;
+  operation.headers = rawHeaderMapAsEnvoyHeaders(trailers->allHeaders());
+  this->submit(operation);
+  this->flushBatch();
+}
+
+void Stream::close(envoy_data data) {
+  envoy_stream_operation operation{};
+  operation.type = ENVOY_STREAM_OP_DATA;
+  operation.data = data;
+  operation.end_stream = true;
+  this->submit(operation);
+  this->flushBatch();
+}
+
+void Stream::close(envoy_data_vector data) {
+  envoy_stream_operation operation{};
+  operation.type = ENVOY_STREAM_OP_DATA_VECTOR;
+  operation.data_vector = data;
+  operation.end_stream = true;
+  this->submit(operation);
+  this->flushBatch();
+}
+
+void Stream::cancel() {
+  envoy_stream_operation operation{};
+  operation.type = ENVOY_STREAM_OP_RESET;
+  this->submit(operation);
+  this->flushBatch();
 }
 
-void Stream::close(envoy_data data) { ::send_data(this->handle_, data, true); }
+Stream& Stream::readData(size_t bytes_to_read) {
+  envoy_stream_operation operation{};
+  operation.type = ENVOY_STREAM_OP_READ_DATA;
+  operation.bytes_to_read = bytes_to_read;
+  this->submit(operation);
+  return *this;
+}
+
+Stream& Stream::startBatch() {
+  this->batching_ = true;
+  return *this;
+}
 
-void Stream::cancel() { reset_stream(this->handle_); }
+Stream& Stream::flushBatch() {
+  this->batching_ = false;
+  if (!this->batch_.empty()) {
+    ::send_stream_operations(this->batch_.data(), this->batch_.size());
+    this->batch_.clear();
+  }
+  return *this;
+}
+
+void Stream::submit(envoy_stream_operation operation) {
+  operation.stream = this->handle_;
+  if (this->batching_) {
+    this->batch_.push_back(operation);
+    return;
+  }
+
+  switch (operation.type) {
+  case ENVOY_STREAM_OP_HEADERS:
+    ::send_headers(operation.stream, operation.headers, operation.end_stream);
+    break;
+  case ENVOY_STREAM_OP_DATA:
+    ::send_data(operation.stream, operation.data, operation.end_stream);
+    break;
+  case ENVOY_STREAM_OP_DATA_VECTOR:
+    ::send_data_vector(operation.stream, operation.data_vector, operation.end_stream);
+    break;
+  case ENVOY_STREAM_OP_TRAILERS:
+    ::send_trailers(operation.stream, operation.headers);
+    break;
+  case ENVOY_STREAM_OP_RESET:
+    ::reset_stream(operation.stream);
+    break;
+  case ENVOY_STREAM_OP_READ_DATA:
+    ::read_data(operation.stream, operation.bytes_to_read);
+    break;
+  case ENVOY_STREAM_OP_START:
+    // Streams are started by StreamPrototype before a Stream is handed out.
+    ::send_stream_operations(&operation, 1);
+    break;
+  }
+}
 
 } // namespace Platform
 } // namespace Envoy
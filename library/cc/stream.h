@@ -13,16 +13,33 @@ namespace Platform {
 class Stream {
 public:
   Stream(envoy_stream_t handle, StreamCallbacksSharedPtr callbacks);
+  ~Stream();
 
   Stream& sendHeaders(RequestHeadersSharedPtr headers, bool end_stream);
   Stream& sendData(envoy_data data);
+  Stream& sendData(envoy_data_vector data);
   void close(RequestTrailersSharedPtr trailers);
   void close(envoy_data data);
+  void close(envoy_data_vector data);
   void cancel();
+  // Only for streams started with explicit flow control: asks for up to bytes_to_read bytes of
+  // response data, delivered in a single on_data callback. On these streams, sendData should also
+  // wait for on_send_window_available after each call.
+  Stream& readData(size_t bytes_to_read);
+
+  // Operations issued between startBatch() and flushBatch() are held back and submitted to Envoy
+  // together, in a single dispatch. close() and cancel() flush any pending batch, as does destroying
+  // the Stream, so that the headers and data held by the batch are always handed over to Envoy.
+  Stream& startBatch();
+  Stream& flushBatch();
 
 private:
+  void submit(envoy_stream_operation operation);
+
   envoy_stream_t handle_;
   StreamCallbacksSharedPtr callbacks_;
+  bool batching_{false};
+  std::vector<envoy_stream_operation> batch_;
 };
 
 using StreamSharedPtr = std::shared_ptr<Stream>;
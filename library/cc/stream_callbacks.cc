@@ -9,6 +9,15 @@ namespace Platform {
 
 namespace {
 
+StreamIntelSharedPtr streamIntelFromC(envoy_stream_intel raw_stream_intel) {
+  StreamIntelSharedPtr stream_intel = std::make_shared<StreamIntel>();
+  stream_intel->attempt_count = raw_stream_intel.attempt_count;
+  stream_intel->upstream_service_time_ms = raw_stream_intel.upstream_service_time_ms;
+  stream_intel->sent_byte_count = raw_stream_intel.sent_byte_count;
+  stream_intel->received_byte_count = raw_stream_intel.received_byte_count;
+  return stream_intel;
+}
+
 void* c_on_headers(envoy_headers headers, bool end_stream, void* context) {
   auto stream_callbacks = static_cast<StreamCallbacks*>(context);
   if (stream_callbacks->on_headers.has_value()) {
@@ -35,6 +44,13 @@ void* c_on_data(envoy_data data, bool end_stream, void* context) {
   return context;
 }
 
+void* c_on_data_vector(envoy_data_vector data, bool end_stream, void* context) {
+  auto stream_callbacks = static_cast<StreamCallbacks*>(context);
+  auto on_data_vector = stream_callbacks->on_data_vector.value();
+  on_data_vector(data, end_stream);
+  return context;
+}
+
 void* c_on_trailers(envoy_headers metadata, void* context) {
   auto stream_callbacks = static_cast<StreamCallbacks*>(context);
   if (stream_callbacks->on_trailers.has_value()) {
@@ -49,7 +65,7 @@ void* c_on_trailers(envoy_headers metadata, void* context) {
   return context;
 }
 
-void* c_on_error(envoy_error raw_error, void* context) {
+void* c_on_error(envoy_error raw_error, envoy_stream_intel raw_stream_intel, void* context) {
   auto stream_callbacks = static_cast<StreamCallbacks*>(context);
   if (stream_callbacks->on_error.has_value()) {
     EnvoyErrorSharedPtr error = std::make_shared<EnvoyError>();
@@ -59,25 +75,43 @@ void* c_on_error(envoy_error raw_error, void* context) {
     error->message = "";
     error->attempt_count = absl::optional<int>(raw_error.attempt_count);
     auto on_error = stream_callbacks->on_error.value();
-    on_error(error);
+    on_error(error, streamIntelFromC(raw_stream_intel));
   }
   return context;
 }
 
-void* c_on_complete(void* context) {
+void* c_on_complete(envoy_stream_intel raw_stream_intel, void* context) {
   auto stream_callbacks = static_cast<StreamCallbacks*>(context);
   if (stream_callbacks->on_complete.has_value()) {
     auto on_complete = stream_callbacks->on_complete.value();
-    on_complete();
+    on_complete(streamIntelFromC(raw_stream_intel));
   }
   return context;
 }
 
-void* c_on_cancel(void* context) {
+void* c_on_cancel(envoy_stream_intel raw_stream_intel, void* context) {
   auto stream_callbacks = static_cast<StreamCallbacks*>(context);
   if (stream_callbacks->on_cancel.has_value()) {
     auto on_cancel = stream_callbacks->on_cancel.value();
-    on_cancel();
+    on_cancel(streamIntelFromC(raw_stream_intel));
+  }
+  return context;
+}
+
+void* c_on_send_window_available(void* context) {
+  auto stream_callbacks = static_cast<StreamCallbacks*>(context);
+  if (stream_callbacks->on_send_window_available.has_value()) {
+    auto on_send_window_available = stream_callbacks->on_send_window_available.value();
+    on_send_window_available();
+  }
+  return context;
+}
+
+void* c_on_stream_timings(envoy_stream_timings timings, void* context) {
+  auto stream_callbacks = static_cast<StreamCallbacks*>(context);
+  if (stream_callbacks->on_stream_timings.has_value()) {
+    auto on_stream_timings = stream_callbacks->on_stream_timings.value();
+    on_stream_timings(timings);
   }
   return context;
 }
@@ -94,6 +128,9 @@ envoy_http_callbacks StreamCallbacks::asEnvoyHttpCallbacks() {
       .on_complete = &c_on_complete,
       .on_cancel = &c_on_cancel,
       .context = this,
+      .on_data_vector = this->on_data_vector.has_value() ? &c_on_data_vector : nullptr,
+      .on_send_window_available = &c_on_send_window_available,
+      .on_stream_timings = &c_on_stream_timings,
   };
 }
 
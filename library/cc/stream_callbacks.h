@@ -9,24 +9,35 @@
 #include "library/common/types/c_types.h"
 #include "response_headers.h"
 #include "response_trailers.h"
+#include "stream_intel.h"
 
 namespace Envoy {
 namespace Platform {
 
 using OnHeadersCallback = std::function<void(ResponseHeadersSharedPtr headers, bool end_stream)>;
 using OnDataCallback = std::function<void(envoy_data data, bool end_stream)>;
+using OnDataVectorCallback = std::function<void(envoy_data_vector data, bool end_stream)>;
 using OnTrailersCallback = std::function<void(ResponseTrailersSharedPtr trailers)>;
-using OnErrorCallback = std::function<void(EnvoyErrorSharedPtr error)>;
-using OnCompleteCallback = std::function<void()>;
-using OnCancelCallback = std::function<void()>;
+using OnErrorCallback =
+    std::function<void(EnvoyErrorSharedPtr error, StreamIntelSharedPtr stream_intel)>;
+using OnCompleteCallback = std::function<void(StreamIntelSharedPtr stream_intel)>;
+using OnCancelCallback = std::function<void(StreamIntelSharedPtr stream_intel)>;
+using OnSendWindowAvailableCallback = std::function<void()>;
+using OnStreamTimingsCallback = std::function<void(envoy_stream_timings timings)>;
 
 struct StreamCallbacks {
   absl::optional<OnHeadersCallback> on_headers;
   absl::optional<OnDataCallback> on_data;
+  // When set, takes precedence over on_data and receives response data without coalescing.
+  absl::optional<OnDataVectorCallback> on_data_vector;
   absl::optional<OnTrailersCallback> on_trailers;
   absl::optional<OnErrorCallback> on_error;
   absl::optional<OnCompleteCallback> on_complete;
   absl::optional<OnCancelCallback> on_cancel;
+  // Only invoked on streams with explicit flow control.
+  absl::optional<OnSendWindowAvailableCallback> on_send_window_available;
+  // Invoked immediately before on_complete, on_error or on_cancel.
+  absl::optional<OnStreamTimingsCallback> on_stream_timings;
 
   envoy_http_callbacks asEnvoyHttpCallbacks();
 };
@@ -9,5 +9,17 @@ StreamPrototypeSharedPtr StreamClient::newStreamPrototype() {
   return std::make_shared<StreamPrototype>(this->engine_);
 }
 
+StreamSharedPtr StreamClient::sendRequest(StreamCallbacksSharedPtr callbacks,
+                                          RequestHeadersSharedPtr headers,
+                                          absl::optional<envoy_data> body,
+                                          RequestTrailersSharedPtr trailers) {
+  return StreamPrototype(this->engine_, callbacks).sendRequest(headers, body, trailers);
+}
+
+StreamRingsSharedPtr StreamClient::newStreamRings(size_t submission_capacity,
+                                                  size_t completion_capacity) {
+  return std::make_shared<StreamRings>(this->engine_, submission_capacity, completion_capacity);
+}
+
 } // namespace Platform
 } // namespace Envoy
@@ -3,6 +3,7 @@
 #include <memory>
 
 #include "stream_prototype.h"
+#include "stream_rings.h"
 
 namespace Envoy {
 namespace Platform {
@@ -12,6 +13,12 @@ public:
   StreamClient(envoy_engine_t engine);
 
   StreamPrototypeSharedPtr newStreamPrototype();
+  // Sends a complete request in a single dispatch, without building a StreamPrototype first.
+  StreamSharedPtr sendRequest(StreamCallbacksSharedPtr callbacks, RequestHeadersSharedPtr headers,
+                              absl::optional<envoy_data> body = absl::nullopt,
+                              RequestTrailersSharedPtr trailers = nullptr);
+  // Drives streams through the engine's submission and completion rings instead of callbacks.
+  StreamRingsSharedPtr newStreamRings(size_t submission_capacity, size_t completion_capacity);
 
 private:
   envoy_engine_t engine_;
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+namespace Envoy {
+namespace Platform {
+
+// What Envoy observed about a stream. Values Envoy did not observe are -1.
+struct StreamIntel {
+  int64_t attempt_count;
+  int64_t upstream_service_time_ms;
+  int64_t sent_byte_count;
+  int64_t received_byte_count;
+};
+
+using StreamIntelSharedPtr = std::shared_ptr<StreamIntel>;
+
+} // namespace Platform
+} // namespace Envoy
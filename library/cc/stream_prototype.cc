@@ -1,5 +1,6 @@
 #include "stream_prototype.h"
 
+#include "bridge_utility.h"
 #include "library/common/main_interface.h"
 
 namespace Envoy {
@@ -9,9 +10,33 @@ StreamPrototype::StreamPrototype(envoy_engine_t engine) : engine_(engine) {
   this->callbacks_ = std::make_shared<StreamCallbacks>();
 }
 
+StreamPrototype::StreamPrototype(envoy_engine_t engine, StreamCallbacksSharedPtr callbacks)
+    : engine_(engine), callbacks_(callbacks) {}
+
 StreamSharedPtr StreamPrototype::start() {
   auto stream = init_stream(this->engine_);
-  start_stream(stream, this->callbacks_->asEnvoyHttpCallbacks());
+  if (this->explicit_flow_control_) {
+    start_flow_controlled_stream(stream, this->callbacks_->asEnvoyHttpCallbacks(),
+                                 this->buffer_limit_);
+  } else {
+    start_stream(stream, this->callbacks_->asEnvoyHttpCallbacks());
+  }
+
+  return std::make_shared<Stream>(stream, this->callbacks_);
+}
+
+StreamSharedPtr StreamPrototype::sendRequest(RequestHeadersSharedPtr headers,
+                                             absl::optional<envoy_data> body,
+                                             RequestTrailersSharedPtr trailers) {
+  auto stream = init_stream(this->engine_);
+  envoy_headers raw_headers = rawHeaderMapAsEnvoyHeaders(headers->allHeaders());
+  envoy_headers raw_trailers{};
+  if (trailers != nullptr) {
+    raw_trailers = rawHeaderMapAsEnvoyHeaders(trailers->allHeaders());
+  }
+  send_request(stream, this->callbacks_->asEnvoyHttpCallbacks(), raw_headers,
+               body.has_value() ? &body.value() : nullptr,
+               trailers != nullptr ? &raw_trailers : nullptr);
 
   return std::make_shared<Stream>(stream, this->callbacks_);
 }
@@ -26,6 +51,11 @@ StreamPrototype& StreamPrototype::setOnData(OnDataCallback closure) {
   return *this;
 }
 
+StreamPrototype& StreamPrototype::setOnDataVector(OnDataVectorCallback closure) {
+  this->callbacks_->on_data_vector = closure;
+  return *this;
+}
+
 StreamPrototype& StreamPrototype::setOnTrailers(OnTrailersCallback closure) {
   this->callbacks_->on_trailers = closure;
   return *this;
@@ -46,5 +76,26 @@ StreamPrototype& StreamPrototype::setOnCancel(OnCancelCallback closure) {
   return *this;
 }
 
+StreamPrototype&
+StreamPrototype::setOnSendWindowAvailable(OnSendWindowAvailableCallback closure) {
+  this->callbacks_->on_send_window_available = closure;
+  return *this;
+}
+
+StreamPrototype& StreamPrototype::setOnStreamTimings(OnStreamTimingsCallback closure) {
+  this->callbacks_->on_stream_timings = closure;
+  return *this;
+}
+
+StreamPrototype& StreamPrototype::setExplicitFlowControl(bool explicit_flow_control) {
+  this->explicit_flow_control_ = explicit_flow_control;
+  return *this;
+}
+
+StreamPrototype& StreamPrototype::setBufferLimit(uint32_t buffer_limit) {
+  this->buffer_limit_ = buffer_limit;
+  return *this;
+}
+
 } // namespace Platform
 } // namespace Envoy
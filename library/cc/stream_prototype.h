@@ -2,8 +2,11 @@
 
 #include <memory>
 
+#include "absl/types/optional.h"
 #include "envoy_error.h"
 #include "library/common/types/c_types.h"
+#include "request_headers.h"
+#include "request_trailers.h"
 #include "response_headers.h"
 #include "response_trailers.h"
 #include "stream.h"
@@ -15,19 +18,36 @@ namespace Platform {
 class StreamPrototype {
 public:
   StreamPrototype(envoy_engine_t engine);
+  StreamPrototype(envoy_engine_t engine, StreamCallbacksSharedPtr callbacks);
 
   StreamSharedPtr start();
+  // Starts a stream and sends a complete request on it in a single dispatch. The request ends on
+  // the last of headers, body and trailers supplied.
+  StreamSharedPtr sendRequest(RequestHeadersSharedPtr headers,
+                              absl::optional<envoy_data> body = absl::nullopt,
+                              RequestTrailersSharedPtr trailers = nullptr);
 
   StreamPrototype& setOnHeaders(OnHeadersCallback closure);
   StreamPrototype& setOnData(OnDataCallback closure);
+  StreamPrototype& setOnDataVector(OnDataVectorCallback closure);
   StreamPrototype& setOnTrailers(OnTrailersCallback closure);
   StreamPrototype& setOnError(OnErrorCallback closure);
   StreamPrototype& setOnComplete(OnCompleteCallback closure);
   StreamPrototype& setOnCancel(OnCancelCallback closure);
+  StreamPrototype& setOnSendWindowAvailable(OnSendWindowAvailableCallback closure);
+  StreamPrototype& setOnStreamTimings(OnStreamTimingsCallback closure);
+  // With explicit flow control, response data is only delivered as it is asked for with
+  // Stream::readData. Applies to streams opened with start().
+  StreamPrototype& setExplicitFlowControl(bool explicit_flow_control);
+  // Bytes of response data buffered before Envoy stops reading, with explicit flow control. 0 uses
+  // the engine's default.
+  StreamPrototype& setBufferLimit(uint32_t buffer_limit);
 
 private:
   envoy_engine_t engine_;
   StreamCallbacksSharedPtr callbacks_;
+  bool explicit_flow_control_{false};
+  uint32_t buffer_limit_{0};
 };
 
 using StreamPrototypeSharedPtr = std::shared_ptr<StreamPrototype>;
@@ -0,0 +1,90 @@
+#include "stream_rings.h"
+
+#include "bridge_utility.h"
+#include "library/common/main_interface.h"
+
+namespace Envoy {
+namespace Platform {
+
+StreamRings::StreamRings(envoy_engine_t engine, size_t submission_capacity,
+                         size_t completion_capacity)
+    : engine_(engine) {
+  init_stream_rings(this->engine_, submission_capacity, completion_capacity);
+}
+
+envoy_stream_t StreamRings::startStream() {
+  envoy_stream_t stream = init_stream(this->engine_);
+  envoy_stream_operation operation{};
+  operation.type = ENVOY_STREAM_OP_START;
+  operation.stream = stream;
+  operation.callbacks = stream_ring_callbacks(this->engine_, stream);
+  this->queue(operation);
+  return stream;
+}
+
+StreamRings& StreamRings::sendHeaders(envoy_stream_t stream, RequestHeadersSharedPtr headers,
+                                      bool end_stream) {
+  envoy_stream_operation operation{};
+  operation.type = ENVOY_STREAM_OP_HEADERS;
+  operation.stream = stream;
+  operation.headers = rawHeaderMapAsEnvoyHeaders(headers->allHeaders());
+  operation.end_stream = end_stream;
+  this->queue(operation);
+  return *this;
+}
+
+StreamRings& StreamRings::sendData(envoy_stream_t stream, envoy_data data, bool end_stream) {
+  envoy_stream_operation operation{};
+  operation.type = ENVOY_STREAM_OP_DATA;
+  operation.stream = stream;
+  operation.data = data;
+  operation.end_stream = end_stream;
+  this->queue(operation);
+  return *this;
+}
+
+StreamRings& StreamRings::sendTrailers(envoy_stream_t stream, RequestTrailersSharedPtr trailers) {
+  envoy_stream_operation operation{};
+  operation.type = ENVOY_STREAM_OP_TRAILERS;
+  operation.stream = stream;
+  operation.headers = rawHeaderMapAsEnvoyHeaders(trailers->allHeaders());
+  this->queue(operation);
+  return *this;
+}
+
+StreamRings& StreamRings::cancel(envoy_stream_t stream) {
+  envoy_stream_operation operation{};
+  operation.type = ENVOY_STREAM_OP_RESET;
+  operation.stream = stream;
+  this->queue(operation);
+  return *this;
+}
+
+size_t StreamRings::submit() {
+  if (this->pending_.empty()) {
+    return 0;
+  }
+  size_t accepted =
+      submit_stream_operations(this->engine_, this->pending_.data(), this->pending_.size());
+  this->pending_.erase(this->pending_.begin(), this->pending_.begin() + accepted);
+  return accepted;
+}
+
+std::vector<envoy_stream_completion> StreamRings::harvest(size_t max) {
+  std::vector<envoy_stream_completion> completions(max);
+  completions.resize(harvest_stream_completions(this->engine_, completions.data(), max));
+  return completions;
+}
+
+std::vector<envoy_stream_completion> StreamRings::poll(size_t max,
+                                                       std::chrono::milliseconds timeout) {
+  std::vector<envoy_stream_completion> completions(max);
+  completions.resize(
+      poll_completions(this->engine_, completions.data(), max, timeout.count()));
+  return completions;
+}
+
+void StreamRings::queue(envoy_stream_operation operation) { this->pending_.push_back(operation); }
+
+} // namespace Platform
+} // namespace Envoy
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "library/common/types/c_types.h"
+#include "request_headers.h"
+#include "request_trailers.h"
+
+namespace Envoy {
+namespace Platform {
+
+// Drives streams through an engine's submission and completion rings. Operations are queued
+// locally until submit() hands them to the engine without blocking; stream events are collected
+// with harvest() instead of being delivered through StreamCallbacks. Not thread-safe: each thread
+// driving streams this way should use its own instance.
+class StreamRings {
+public:
+  StreamRings(envoy_engine_t engine, size_t submission_capacity, size_t completion_capacity);
+
+  envoy_stream_t startStream();
+  StreamRings& sendHeaders(envoy_stream_t stream, RequestHeadersSharedPtr headers,
+                           bool end_stream);
+  StreamRings& sendData(envoy_stream_t stream, envoy_data data, bool end_stream);
+  StreamRings& sendTrailers(envoy_stream_t stream, RequestTrailersSharedPtr trailers);
+  StreamRings& cancel(envoy_stream_t stream);
+
+  // Pushes queued operations onto the submission ring, returning how many were accepted. Any that
+  // did not fit stay queued, in order, for the next call.
+  size_t submit();
+  // Collects up to max stream events. Ownership of each event's payload passes to the caller.
+  std::vector<envoy_stream_completion> harvest(size_t max);
+  // As harvest(), but waits up to timeout for an event if none are ready.
+  std::vector<envoy_stream_completion> poll(size_t max, std::chrono::milliseconds timeout);
+
+private:
+  void queue(envoy_stream_operation operation);
+
+  envoy_engine_t engine_;
+  std::vector<envoy_stream_operation> pending_;
+};
+
+using StreamRingsSharedPtr = std::shared_ptr<StreamRings>;
+
+} // namespace Platform
+} // namespace Envoy
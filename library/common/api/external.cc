@@ -2,8 +2,6 @@
 
 #include "common/common/assert.h"
 
-#include "absl/container/flat_hash_map.h"
-
 namespace Envoy {
 namespace Api {
 namespace External {
@@ -12,6 +10,22 @@ namespace External {
 // See https://github.com/lyft/envoy-mobile/issues/332
 static absl::flat_hash_map<std::string, void*> registry_{};
 
+// The registry of the engine running on this thread, if any.
+static thread_local const Registry* scoped_registry_{};
+
+void Registry::registerApi(std::string name, void* api) { apis_[name] = api; }
+
+void* Registry::findApi(const std::string& name) const {
+  auto it = apis_.find(name);
+  return it == apis_.end() ? nullptr : it->second;
+}
+
+ScopedRegistry::ScopedRegistry(const Registry& registry) : previous_(scoped_registry_) {
+  scoped_registry_ = &registry;
+}
+
+ScopedRegistry::~ScopedRegistry() { scoped_registry_ = previous_; }
+
 // TODO(goaway): To expose this for general usage, it will need to be made thread-safe. For now it
 // relies on the assumption that usage will occur only as part of Engine configuration, and thus be
 // limited to a single thread.
@@ -20,6 +34,11 @@ void registerApi(std::string name, void* api) { registry_[name] = api; }
 // TODO(goaway): This is not thread-safe, but the assumption here is that all writes will complete
 // before any reads occur.
 void* retrieveApi(std::string name) {
+  if (scoped_registry_ != nullptr) {
+    if (void* api = scoped_registry_->findApi(name)) {
+      return api;
+    }
+  }
   void* api = registry_[name];
   ASSERT(api, fmt::format("{} not registered", name));
   return api;
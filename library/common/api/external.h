@@ -1,11 +1,50 @@
 #pragma once
 
+#include <memory>
 #include <string>
 
+#include "absl/container/flat_hash_map.h"
+
 namespace Envoy {
 namespace Api {
 namespace External {
 
+/**
+ * A set of external runtime APIs visible to a single engine. While a thread is scoped to a registry
+ * (see ScopedRegistry), retrieveApi() consults it ahead of the process-wide registry.
+ * Like the process-wide registry, it relies on all registrations completing before the engine that
+ * uses it starts.
+ */
+class Registry {
+public:
+  /**
+   * Register an external runtime API for usage by this registry's engine.
+   */
+  void registerApi(std::string name, void* api);
+
+  /**
+   * @return void*, the API registered under name, or nullptr if there is none.
+   */
+  void* findApi(const std::string& name) const;
+
+private:
+  absl::flat_hash_map<std::string, void*> apis_;
+};
+
+using RegistrySharedPtr = std::shared_ptr<Registry>;
+
+/**
+ * Scopes the constructing thread to a registry for the lifetime of this object.
+ */
+class ScopedRegistry {
+public:
+  explicit ScopedRegistry(const Registry& registry);
+  ~ScopedRegistry();
+
+private:
+  const Registry* previous_;
+};
+
 /**
  * Register an external runtime API for usage (e.g. in extensions).
  */
@@ -0,0 +1,88 @@
+#include "library/common/buffer/bridge_fragment.h"
+
+#include <atomic>
+#include <new>
+#include <vector>
+
+#include "library/common/common/exit_safe_thread_local.h"
+
+namespace Envoy {
+namespace Buffer {
+
+namespace {
+
+// Upper bound on the fragments each thread keeps for reuse.
+constexpr size_t MaxFreeFragments = 256;
+
+std::atomic<uint64_t> pooled_allocations{0};
+std::atomic<uint64_t> fresh_allocations{0};
+
+// Raw storage of destroyed fragments, ready to be constructed into again.
+class BridgeFragmentFreelist {
+public:
+  BridgeFragmentFreelist() { fragments_.reserve(MaxFreeFragments); }
+
+  ~BridgeFragmentFreelist() {
+    for (void* storage : fragments_) {
+      ::operator delete(storage);
+    }
+  }
+
+  // Returns storage for a fragment, or nullptr if the freelist is empty.
+  void* pop() {
+    if (fragments_.empty()) {
+      return nullptr;
+    }
+    void* storage = fragments_.back();
+    fragments_.pop_back();
+    return storage;
+  }
+
+  // Takes the storage of a destroyed fragment, returning false if the freelist is full.
+  bool push(void* storage) {
+    if (fragments_.size() >= MaxFreeFragments) {
+      return false;
+    }
+    fragments_.push_back(storage);
+    return true;
+  }
+
+  // Returns the calling thread's freelist, or nullptr once it has been destroyed.
+  static BridgeFragmentFreelist* get() {
+    return ExitSafeThreadLocal<BridgeFragmentFreelist>::get();
+  }
+
+private:
+  std::vector<void*> fragments_;
+};
+
+} // namespace
+
+BridgeFragment* BridgeFragmentFactory::create(envoy_data data) {
+  BridgeFragmentFreelist* freelist = BridgeFragmentFreelist::get();
+  void* storage = freelist != nullptr ? freelist->pop() : nullptr;
+  if (storage != nullptr) {
+    pooled_allocations.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    fresh_allocations.fetch_add(1, std::memory_order_relaxed);
+    storage = ::operator new(sizeof(BridgeFragment));
+  }
+  return new (storage) BridgeFragment(data);
+}
+
+void BridgeFragmentFactory::recycle(BridgeFragment* fragment) {
+  void* storage = fragment;
+  fragment->~BridgeFragment();
+  BridgeFragmentFreelist* freelist = BridgeFragmentFreelist::get();
+  if (freelist == nullptr || !freelist->push(storage)) {
+    ::operator delete(storage);
+  }
+}
+
+BridgeFragmentAllocationStats BridgeFragmentFactory::stats() {
+  return {pooled_allocations.load(std::memory_order_relaxed),
+          fresh_allocations.load(std::memory_order_relaxed)};
+}
+
+} // namespace Buffer
+} // namespace Envoy
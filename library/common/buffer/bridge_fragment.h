@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 #include "envoy/buffer/buffer.h"
 
 #include "common/common/non_copyable.h"
@@ -9,23 +11,60 @@
 namespace Envoy {
 namespace Buffer {
 
+class BridgeFragment;
+
+/**
+ * Allocation counters for BridgeFragments, aggregated across all threads.
+ */
+struct BridgeFragmentAllocationStats {
+  // Fragments served from a freelist.
+  uint64_t pooled_;
+  // Fragments that required a fresh heap allocation.
+  uint64_t fresh_;
+};
+
+/**
+ * Creates BridgeFragments, recycling them through a bounded per-thread freelist once done() so
+ * that streams of many small chunks do not pay a heap allocation per fragment.
+ */
+class BridgeFragmentFactory {
+public:
+  /**
+   * @param data, the envoy_data to wrap. Ownership passes to the fragment, which releases data
+   * once done() is called.
+   * @return BridgeFragment*, a fragment that recycles itself when done() is called.
+   */
+  static BridgeFragment* create(envoy_data data);
+
+  /**
+   * @return BridgeFragmentAllocationStats, a snapshot of pooled versus fresh allocations.
+   */
+  static BridgeFragmentAllocationStats stats();
+
+private:
+  friend class BridgeFragment;
+  static void recycle(BridgeFragment* fragment);
+};
+
 /**
  * An implementation of BufferFragment backed by envoy_data.
  */
 class BridgeFragment : NonCopyable, public BufferFragment {
 public:
-  // TODO: Consider moving this to a BridgeFragmentFactory class.
-  static BridgeFragment* createBridgeFragment(envoy_data data) { return new BridgeFragment(data); }
+  static BridgeFragment* createBridgeFragment(envoy_data data) {
+    return BridgeFragmentFactory::create(data);
+  }
 
   // Buffer::BufferFragment
   const void* data() const override { return data_.bytes; }
   size_t size() const override { return data_.length; }
   void done() override {
     data_.release(data_.context);
-    delete this;
+    BridgeFragmentFactory::recycle(this);
   }
 
 private:
+  friend class BridgeFragmentFactory;
   BridgeFragment(envoy_data data) : data_(data) {}
   ~BridgeFragment() {}
   envoy_data data_;
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+#include "common/common/non_copyable.h"
+
+namespace Envoy {
+
+/**
+ * Free list of fixed-size memory blocks, for objects that are created and destroyed at high rates
+ * on a single thread. Released blocks are kept for reuse up to max_free_blocks and returned to the
+ * heap beyond that. Requests of any other size go straight to the heap.
+ *
+ * Not thread-safe.
+ */
+class BlockPool : NonCopyable {
+public:
+  BlockPool(size_t block_size, size_t max_free_blocks)
+      : block_size_(block_size), max_free_blocks_(max_free_blocks) {}
+
+  ~BlockPool() {
+    for (void* block : free_blocks_) {
+      ::operator delete(block);
+    }
+  }
+
+  /**
+   * @param size, the number of bytes needed.
+   * @return void*, a block of at least size bytes.
+   */
+  void* allocate(size_t size) {
+    if (size != block_size_ || free_blocks_.empty()) {
+      return ::operator new(size);
+    }
+    void* block = free_blocks_.back();
+    free_blocks_.pop_back();
+    reused_++;
+    return block;
+  }
+
+  /**
+   * @param block, a block previously returned by allocate.
+   * @param size, the size that block was allocated with.
+   */
+  void release(void* block, size_t size) {
+    if (size != block_size_ || free_blocks_.size() >= max_free_blocks_) {
+      ::operator delete(block);
+      return;
+    }
+    free_blocks_.push_back(block);
+  }
+
+  /**
+   * @return size_t, the number of released blocks held for reuse.
+   */
+  size_t freeBlocks() const { return free_blocks_.size(); }
+
+  /**
+   * @return uint64_t, the number of allocations served from released blocks.
+   */
+  uint64_t reused() const { return reused_; }
+
+private:
+  const size_t block_size_;
+  const size_t max_free_blocks_;
+  std::vector<void*> free_blocks_;
+  uint64_t reused_{};
+};
+
+} // namespace Envoy
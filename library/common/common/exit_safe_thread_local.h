@@ -0,0 +1,37 @@
+#pragma once
+
+namespace Envoy {
+
+/**
+ * Lazily constructed per-thread instance of T that may still be asked for while its thread is
+ * exiting. Thread-local destructors run in an unspecified order relative to one another, so code
+ * reached from another thread-local's destructor can call get() after the instance is gone; it
+ * gets nullptr instead of a destroyed object and must fall back to a shared path.
+ */
+template <class T> class ExitSafeThreadLocal {
+public:
+  /**
+   * @return T*, the calling thread's instance, or nullptr once it has been destroyed during thread
+   *         exit.
+   */
+  static T* get() {
+    if (destroyed_) {
+      return nullptr;
+    }
+    static thread_local Holder holder;
+    return &holder.value_;
+  }
+
+private:
+  struct Holder {
+    // Flagged before value_ is torn down, so its destructor sees nullptr as well.
+    ~Holder() { destroyed_ = true; }
+
+    T value_;
+  };
+
+  // Trivially destructible, so it remains readable after the holder has been destroyed.
+  static inline thread_local bool destroyed_ = false;
+};
+
+} // namespace Envoy
@@ -0,0 +1,166 @@
+#include "library/common/data/payload_pool.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include "common/common/assert.h"
+#include "common/common/macros.h"
+
+#include "library/common/common/exit_safe_thread_local.h"
+
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+
+namespace Envoy {
+namespace Data {
+
+namespace {
+
+constexpr size_t SizeClasses[] = {64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384};
+constexpr uint32_t NumSizeClasses = sizeof(SizeClasses) / sizeof(SizeClasses[0]);
+// Size class recorded for blocks that are too large to pool.
+constexpr uint32_t Unpooled = NumSizeClasses;
+
+// Free blocks each thread caches per size class. When full, half are handed to the depot.
+constexpr size_t MagazineSize = 32;
+// Bytes the depot retains per size class; blocks beyond this are returned to malloc.
+constexpr size_t DepotBytesPerClass = 512 * 1024;
+
+// Every block is prefixed with a header recording its size class. The header occupies a full
+// alignment unit so that the returned buffer keeps malloc's alignment guarantees.
+struct BlockHeader {
+  uint32_t size_class_;
+};
+constexpr size_t HeaderSize = alignof(std::max_align_t);
+static_assert(sizeof(BlockHeader) <= HeaderSize, "block header must fit in its alignment unit");
+
+uint32_t sizeClassFor(size_t size) {
+  for (uint32_t i = 0; i < NumSizeClasses; i++) {
+    if (size <= SizeClasses[i]) {
+      return i;
+    }
+  }
+  return Unpooled;
+}
+
+BlockHeader* headerOf(void* ptr) {
+  return reinterpret_cast<BlockHeader*>(static_cast<uint8_t*>(ptr) - HeaderSize);
+}
+
+void* newBlock(uint32_t size_class, size_t size) {
+  const size_t capacity = size_class == Unpooled ? size : SizeClasses[size_class];
+  void* block = malloc(HeaderSize + capacity);
+  RELEASE_ASSERT(block != nullptr, "malloc failure");
+  static_cast<BlockHeader*>(block)->size_class_ = size_class;
+  return static_cast<uint8_t*>(block) + HeaderSize;
+}
+
+void freeBlock(void* ptr) { free(headerOf(ptr)); }
+
+class Depot {
+public:
+  // Moves up to count free blocks of size_class into out, returning how many were moved.
+  size_t take(uint32_t size_class, void** out, size_t count) {
+    absl::MutexLock lock(&mutex_);
+    std::vector<void*>& blocks = blocks_[size_class];
+    const size_t taken = std::min(count, blocks.size());
+    for (size_t i = 0; i < taken; i++) {
+      out[i] = blocks.back();
+      blocks.pop_back();
+    }
+    return taken;
+  }
+
+  // Takes ownership of count free blocks of size_class, freeing any the depot cannot retain.
+  void give(uint32_t size_class, void** in, size_t count) {
+    const size_t limit = std::max(DepotBytesPerClass / SizeClasses[size_class], MagazineSize);
+    {
+      absl::MutexLock lock(&mutex_);
+      std::vector<void*>& blocks = blocks_[size_class];
+      while (count > 0 && blocks.size() < limit) {
+        blocks.push_back(in[--count]);
+      }
+    }
+    for (size_t i = 0; i < count; i++) {
+      freeBlock(in[i]);
+    }
+  }
+
+private:
+  absl::Mutex mutex_;
+  std::vector<void*> blocks_[NumSizeClasses] ABSL_GUARDED_BY(mutex_);
+};
+
+// Intentionally leaked so that threads exiting during process teardown can still return blocks.
+Depot& depot() { MUTABLE_CONSTRUCT_ON_FIRST_USE(Depot); }
+
+class ThreadCache {
+public:
+  ~ThreadCache() {
+    for (uint32_t size_class = 0; size_class < NumSizeClasses; size_class++) {
+      depot().give(size_class, blocks_[size_class], counts_[size_class]);
+    }
+  }
+
+  void* allocate(uint32_t size_class) {
+    size_t& count = counts_[size_class];
+    if (count == 0) {
+      count = depot().take(size_class, blocks_[size_class], MagazineSize / 2);
+    }
+    return count > 0 ? blocks_[size_class][--count] : nullptr;
+  }
+
+  void release(uint32_t size_class, void* ptr) {
+    size_t& count = counts_[size_class];
+    if (count == MagazineSize) {
+      depot().give(size_class, blocks_[size_class] + MagazineSize / 2, MagazineSize / 2);
+      count = MagazineSize / 2;
+    }
+    blocks_[size_class][count++] = ptr;
+  }
+
+private:
+  void* blocks_[NumSizeClasses][MagazineSize];
+  size_t counts_[NumSizeClasses]{};
+};
+
+// Returns the calling thread's cache, or nullptr once it has been destroyed during thread exit.
+ThreadCache* threadCache() { return ExitSafeThreadLocal<ThreadCache>::get(); }
+
+} // namespace
+
+void* PayloadPool::allocate(size_t size) {
+  const uint32_t size_class = sizeClassFor(size);
+  if (size_class != Unpooled) {
+    ThreadCache* cache = threadCache();
+    void* ptr = cache != nullptr ? cache->allocate(size_class) : nullptr;
+    if (ptr != nullptr) {
+      return ptr;
+    }
+  }
+  return newBlock(size_class, size);
+}
+
+void PayloadPool::release(void* ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+  const uint32_t size_class = headerOf(ptr)->size_class_;
+  ASSERT(size_class <= Unpooled);
+  if (size_class == Unpooled) {
+    freeBlock(ptr);
+    return;
+  }
+  ThreadCache* cache = threadCache();
+  if (cache != nullptr) {
+    cache->release(size_class, ptr);
+  } else {
+    depot().give(size_class, &ptr, 1);
+  }
+}
+
+} // namespace Data
+} // namespace Envoy
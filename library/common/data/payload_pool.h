@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Envoy {
+namespace Data {
+
+/**
+ * Size-class pooled allocator for payload buffers that cross the bridge.
+ *
+ * Payloads are usually allocated on one thread (the Envoy thread, or a platform thread sending
+ * data) and released on another, so each thread keeps a small cache of free blocks per size class
+ * and exchanges batches of blocks with a shared, mutex-guarded depot. This keeps the general
+ * purpose allocator, and contention on its locks, off the common path. Requests larger than the
+ * largest size class are served by malloc directly.
+ */
+class PayloadPool {
+public:
+  /**
+   * Allocates a buffer from the pool.
+   * @param size, the number of bytes required.
+   * @return void*, a buffer of at least size bytes. Never nullptr.
+   */
+  static void* allocate(size_t size);
+
+  /**
+   * Returns a buffer obtained from allocate() to the pool. May be called from any thread.
+   * @param ptr, the buffer to release. nullptr is ignored.
+   */
+  static void release(void* ptr);
+};
+
+} // namespace Data
+} // namespace Envoy
@@ -3,6 +3,7 @@
 #include <stdlib.h>
 
 #include "common/buffer/buffer_impl.h"
+#include "common/common/assert.h"
 #include "common/common/empty_string.h"
 
 #include "library/common/buffer/bridge_fragment.h"
@@ -11,6 +12,65 @@ namespace Envoy {
 namespace Data {
 namespace Utility {
 
+namespace {
+
+void releaseSliceData(void* context) { delete static_cast<Buffer::SliceData*>(context); }
+
+/**
+ * Tracks the segments of an envoy_data_vector that have been handed to Envoy as individual
+ * BridgeFragments, so that the vector itself is released once every segment has been drained.
+ * Fragments are only drained on the engine thread, so the pending count is not synchronized.
+ */
+class DataVectorReleaser {
+public:
+  static Buffer::InstancePtr toInternalData(envoy_data_vector data) {
+    Buffer::InstancePtr buf = std::make_unique<Buffer::OwnedImpl>();
+    if (data.length == 0) {
+      data.release(data.context);
+      return buf;
+    }
+
+    // The releaser deletes itself when the last segment is released.
+    auto* releaser = new DataVectorReleaser(data);
+    for (envoy_data_vector_size_t i = 0; i < data.length; i++) {
+      envoy_data segment = {data.segments[i].length, data.segments[i].bytes, releaseSegment,
+                            &releaser->segment_refs_[i]};
+      buf->addBufferFragment(*Buffer::BridgeFragment::createBridgeFragment(segment));
+    }
+    return buf;
+  }
+
+private:
+  struct SegmentRef {
+    DataVectorReleaser* parent_;
+    envoy_data_vector_size_t index_;
+  };
+
+  DataVectorReleaser(envoy_data_vector data) : data_(data), pending_(data.length) {
+    segment_refs_.reserve(data.length);
+    for (envoy_data_vector_size_t i = 0; i < data.length; i++) {
+      segment_refs_.push_back({this, i});
+    }
+  }
+
+  static void releaseSegment(void* context) {
+    SegmentRef* ref = static_cast<SegmentRef*>(context);
+    DataVectorReleaser* parent = ref->parent_;
+    const envoy_data& segment = parent->data_.segments[ref->index_];
+    segment.release(segment.context);
+    if (--parent->pending_ == 0) {
+      parent->data_.release(parent->data_.context);
+      delete parent;
+    }
+  }
+
+  const envoy_data_vector data_;
+  envoy_data_vector_size_t pending_;
+  std::vector<SegmentRef> segment_refs_;
+};
+
+} // namespace
+
 Buffer::InstancePtr toInternalData(envoy_data data) {
   // This fragment only needs to live until done is called.
   // Therefore, it is sufficient to allocate on the heap, and delete in the done method.
@@ -20,22 +80,59 @@ Buffer::InstancePtr toInternalData(envoy_data data) {
   return buf;
 }
 
+Buffer::InstancePtr toInternalData(envoy_data_vector data) {
+  return DataVectorReleaser::toInternalData(data);
+}
+
 envoy_data toBridgeData(Buffer::Instance& data) {
+  if (data.length() == 0) {
+    return envoy_nodata;
+  }
+
+  // When the buffer is backed by a single slice, ownership of the slice itself is handed over to
+  // the platform, avoiding a copy of the payload. The slice is freed when the platform releases the
+  // envoy_data.
+  if (data.getRawSlices(2).size() == 1) {
+    Buffer::SliceDataPtr slice = data.extractMutableFrontSlice();
+    absl::Span<uint8_t> slice_data = slice->getMutableData();
+    ASSERT(data.length() == 0, "extracting the only slice should leave the buffer empty");
+    return {slice_data.size(), slice_data.data(), releaseSliceData, slice.release()};
+  }
+
   envoy_data bridge_data = copyToBridgeData(data);
   data.drain(bridge_data.length);
   return bridge_data;
 }
 
+envoy_data_vector toBridgeDataVector(Buffer::Instance& data) {
+  const envoy_data_vector_size_t slice_count = data.getRawSlices().size();
+  if (slice_count == 0) {
+    return envoy_nodata_vector;
+  }
+
+  envoy_data* segments = static_cast<envoy_data*>(safe_malloc(sizeof(envoy_data) * slice_count));
+  envoy_data_vector_size_t length = 0;
+  while (data.length() > 0) {
+    ASSERT(length < slice_count, "buffer gained slices while being transformed");
+    Buffer::SliceDataPtr slice = data.extractMutableFrontSlice();
+    absl::Span<uint8_t> slice_data = slice->getMutableData();
+    segments[length++] = {slice_data.size(), slice_data.data(), releaseSliceData, slice.release()};
+  }
+  // Note: the segment array is allocated with malloc, so free is an appropriate release function
+  // for the vector and the array itself an appropriate context.
+  return {length, segments, free, segments};
+}
+
 envoy_data copyToBridgeData(absl::string_view str) {
-  uint8_t* buffer = static_cast<uint8_t*>(safe_malloc(sizeof(uint8_t) * str.length()));
+  uint8_t* buffer = static_cast<uint8_t*>(safe_pool_malloc(sizeof(uint8_t) * str.length()));
   memcpy(buffer, str.data(), str.length()); // NOLINT(safe-memcpy)
-  return {str.length(), buffer, free, buffer};
+  return {str.length(), buffer, envoy_pool_release, buffer};
 }
 
 envoy_data copyToBridgeData(const Buffer::Instance& data) {
-  uint8_t* buffer = static_cast<uint8_t*>(safe_malloc(sizeof(uint8_t) * data.length()));
+  uint8_t* buffer = static_cast<uint8_t*>(safe_pool_malloc(sizeof(uint8_t) * data.length()));
   data.copyOut(0, data.length(), buffer);
-  return {static_cast<size_t>(data.length()), buffer, free, buffer};
+  return {static_cast<size_t>(data.length()), buffer, envoy_pool_release, buffer};
 }
 
 std::string copyToString(envoy_data data) {
@@ -16,12 +16,32 @@ namespace Utility {
 Buffer::InstancePtr toInternalData(envoy_data data);
 
 /**
- * Transform from Buffer::Instance to envoy_data.
+ * Transform envoy_data_vector to Envoy::Buffer::Instance without coalescing its segments.
+ * Each segment is released as soon as it is drained from the buffer, and the vector itself is
+ * released after its last segment.
+ * @param data, the envoy_data_vector to transform.
+ * @return Envoy::Buffer::InstancePtr, the native transformation of the envoy_data_vector param.
+ */
+Buffer::InstancePtr toInternalData(envoy_data_vector data);
+
+/**
+ * Transform from Buffer::Instance to envoy_data. The Buffer::Instance is drained.
+ * If the buffer consists of a single slice, the slice is moved into the returned envoy_data
+ * without copying; its memory is freed when the envoy_data is released. Otherwise the contents are
+ * coalesced into a newly allocated array.
  * @param data, the Buffer::Instance to transform.
  * @return envoy_data, the bridge transformation of the Buffer::Instance param.
  */
 envoy_data toBridgeData(Buffer::Instance&);
 
+/**
+ * Transform from Buffer::Instance to envoy_data_vector, moving each slice of the buffer into its
+ * own segment without copying. The Buffer::Instance is drained.
+ * @param data, the Buffer::Instance to transform.
+ * @return envoy_data_vector, the bridge transformation of the Buffer::Instance param.
+ */
+envoy_data_vector toBridgeDataVector(Buffer::Instance&);
+
 /**
  * Copy from string to envoy_data.
  * @param str, the string to copy.
@@ -9,18 +9,28 @@
 
 namespace Envoy {
 
+namespace {
+// How often the main thread's event loop is sampled for lag, and how many of the slowest callbacks
+// run on it are kept. Sampling costs one timer wakeup per interval.
+constexpr std::chrono::milliseconds LoopLagSampleInterval{500};
+constexpr size_t MaxSlowLoopCallbacks = 10;
+} // namespace
+
 Engine::Engine(envoy_engine_callbacks callbacks, envoy_logger logger,
-               std::atomic<envoy_network_t>& preferred_network)
+               std::atomic<envoy_network_t>& preferred_network,
+               Api::External::RegistrySharedPtr api_registry)
     : callbacks_(callbacks), logger_(logger),
       dispatcher_(std::make_unique<Event::ProvisionalDispatcher>()),
-      preferred_network_(preferred_network) {
-  // Ensure static factory registration occurs on time.
-  // TODO: ensure this is only called one time once multiple Engine objects can be allocated.
-  // https://github.com/lyft/envoy-mobile/issues/332
-  ExtensionRegistry::registerFactories();
+      preferred_network_(preferred_network), api_registry_(std::move(api_registry)) {
+  // Ensure static factory registration occurs on time, and only once for the process, as engines
+  // may be created repeatedly.
+  static absl::once_flag register_factories;
+  absl::call_once(register_factories, &ExtensionRegistry::registerFactories);
 }
 
 envoy_status_t Engine::run(const std::string config, const std::string log_level) {
+  // Read from the same time source the client measures the first dispatched request against.
+  run_time_ = time_system_.monotonicTime();
   // Start the Envoy on the dedicated thread. Note: due to how the assignment operator works with
   // std::thread, main_thread_ is the same object after this call, but its state is replaced with
   // that of the temporary. The temporary object's state becomes the default state, which does
@@ -30,6 +40,8 @@ envoy_status_t Engine::run(const std::string config, const std::string log_level
 }
 
 envoy_status_t Engine::main(const std::string config, const std::string log_level) {
+  // Extensions configured on this thread see this engine's external APIs ahead of global ones.
+  Api::External::ScopedRegistry api_scope(*api_registry_);
   // Using unique_ptr ensures main_common's lifespan is strictly scoped to this function.
   std::unique_ptr<MobileMainCommon> main_common;
   {
@@ -69,15 +81,14 @@ envoy_status_t Engine::main(const std::string config, const std::string log_leve
       return ENVOY_FAILURE;
     }
 
-    // Note: We're waiting longer than we might otherwise to drain to the main thread's dispatcher.
-    // This is because we're not simply waiting for its availability and for it to have started, but
-    // also because we're waiting for clusters to have done their first attempt at DNS resolution.
-    // When we improve synchronous failure handling and/or move to dynamic forwarding, we only need
-    // to wait until the dispatcher is running (and can drain by enqueueing a drain callback on it,
-    // as we did previously).
-
-    postinit_callback_handler_ = main_common->server()->lifecycleNotifier().registerCallback(
-        Envoy::Server::ServerLifecycleNotifier::Stage::PostInit, [this]() -> void {
+    // By default we wait longer than we might otherwise to drain to the main thread's dispatcher:
+    // not only for the dispatcher to have started, but also for clusters to have done their first
+    // attempt at DNS resolution. In fast start mode streams are drained as soon as the dispatcher
+    // and ApiListener exist, and hosts are resolved per request by the dynamic forward proxy.
+    const auto stage = fast_start_ ? Envoy::Server::ServerLifecycleNotifier::Stage::Startup
+                                   : Envoy::Server::ServerLifecycleNotifier::Stage::PostInit;
+    init_callback_handler_ = main_common->server()->lifecycleNotifier().registerCallback(
+        stage, [this]() -> void {
           client_scope_ = server_->serverFactoryContext().scope().createScope("pulse.");
           // StatNameSet is lock-free, the benefit of using it is being able to create StatsName
           // on-the-fly without risking contention on system with lots of threads.
@@ -85,9 +96,14 @@ envoy_status_t Engine::main(const std::string config, const std::string log_leve
           stat_name_set_ = client_scope_->symbolTable().makeSet("pulse");
           auto api_listener = server_->listenerManager().apiListener()->get().http();
           ASSERT(api_listener.has_value());
-          http_client_ = std::make_unique<Http::Client>(api_listener.value(), *dispatcher_,
-                                                        server_->serverFactoryContext().scope(),
-                                                        preferred_network_);
+          http_client_ = std::make_unique<Http::Client>(
+              api_listener.value(), *dispatcher_, server_->serverFactoryContext().scope(),
+              preferred_network_, time_system_, stream_stride_);
+          http_client_->setEngineStartTime(run_time_);
+          loop_lag_monitor_ = std::make_unique<Event::LoopLagMonitor>(
+              server_->dispatcher(), server_->serverFactoryContext().scope(),
+              LoopLagSampleInterval, MaxSlowLoopCallbacks);
+          dispatcher_->initializeStats(server_->serverFactoryContext().scope());
           dispatcher_->drain(server_->dispatcher());
           if (callbacks_.on_engine_running != nullptr) {
             callbacks_.on_engine_running(callbacks_.context);
@@ -100,7 +116,8 @@ envoy_status_t Engine::main(const std::string config, const std::string log_leve
   // The above call is blocking; at this point the event loop has exited.
 
   // Ensure destructors run on Envoy's main thread.
-  postinit_callback_handler_.reset(nullptr);
+  init_callback_handler_.reset(nullptr);
+  loop_lag_monitor_.reset(nullptr);
   client_scope_.reset(nullptr);
   stat_name_set_.reset();
   lambda_logger_.reset(nullptr);
@@ -228,6 +245,24 @@ envoy_status_t Engine::recordHistogramValue(const std::string& elements, envoy_s
 
 Event::ProvisionalDispatcher& Engine::dispatcher() { return *dispatcher_; }
 
+envoy_status_t Engine::initStreamRings(size_t submission_capacity, size_t completion_capacity) {
+  Thread::LockGuard lock(mutex_);
+  if (stream_rings_ == nullptr) {
+    // Submissions are applied through the dispatcher, so the client is guaranteed to exist by
+    // the time any of them runs.
+    stream_rings_ = std::make_unique<Http::StreamRings>(
+        *dispatcher_,
+        [this](const envoy_stream_operation* operations, size_t count) -> void {
+          http_client_->applyStreamOperations(operations, count);
+        },
+        submission_capacity, completion_capacity);
+    stream_rings_view_.store(stream_rings_.get());
+  }
+  return ENVOY_SUCCESS;
+}
+
+Http::StreamRings* Engine::streamRings() { return stream_rings_view_.load(); }
+
 Http::Client& Engine::httpClient() {
   RELEASE_ASSERT(dispatcher_->isThreadSafe(),
                  "httpClient must be accessed from dispatcher's context");
@@ -3,13 +3,17 @@
 #include "envoy/server/lifecycle_notifier.h"
 
 #include "common/common/logger.h"
+#include "common/event/real_time_system.h"
 #include "common/upstream/logical_dns_cluster.h"
 
 #include "absl/base/call_once.h"
 #include "extension_registry.h"
+#include "library/common/api/external.h"
 #include "library/common/common/lambda_logger_delegate.h"
 #include "library/common/envoy_mobile_main_common.h"
+#include "library/common/event/loop_lag_monitor.h"
 #include "library/common/http/client.h"
+#include "library/common/http/stream_rings.h"
 #include "library/common/types/c_types.h"
 
 namespace Envoy {
@@ -21,15 +25,33 @@ public:
    * @param callbacks, the callbacks to use for engine lifecycle monitoring.
    * @param logger, the callbacks to use for engine logging.
    * @param preferred_network, hook to obtain the preferred network for new streams.
+   * @param api_registry, external APIs registered for this engine in particular.
    */
   Engine(envoy_engine_callbacks callbacks, envoy_logger logger,
-         std::atomic<envoy_network_t>& preferred_network);
+         std::atomic<envoy_network_t>& preferred_network,
+         Api::External::RegistrySharedPtr api_registry);
 
   /**
    * Engine destructor.
    */
   ~Engine();
 
+  /**
+   * Drain the dispatcher as soon as the server is about to run its event loop, rather than once
+   * it has initialized. Streams may then be started before clusters have resolved their hosts, so
+   * this suits configurations that resolve per request through the dynamic forward proxy cluster.
+   * Must be called before run().
+   * @param fast_start, whether to start early.
+   */
+  void setFastStart(bool fast_start) { fast_start_ = fast_start; }
+
+  /**
+   * Tell the engine that it runs every stride-th stream handle, as one of several workers that an
+   * engine handle shards its streams across. Must be called before run().
+   * @param stride, the number of workers sharing the engine handle.
+   */
+  void setStreamStride(size_t stride) { stream_stride_ = stride; }
+
   /**
    * Run the engine with the provided configuration.
    * @param config, the Envoy bootstrap configuration to use.
@@ -54,6 +76,27 @@ public:
    */
   Http::Client& httpClient();
 
+  /**
+   * Accessor for the engine's clock. May be called from any thread. Latencies that start on the
+   * platform's thread and end on Envoy's are measured against it at both ends.
+   * @return TimeSource&, the engine's time source.
+   */
+  TimeSource& timeSource() { return time_system_; }
+
+  /**
+   * Set up the engine's submission and completion rings. Only the first call has any effect.
+   * @param submission_capacity, capacity of the submission ring. Must be a power of two.
+   * @param completion_capacity, capacity of the completion ring. Must be a power of two.
+   * @return envoy_status_t, ENVOY_SUCCESS if the rings are ready for use.
+   */
+  envoy_status_t initStreamRings(size_t submission_capacity, size_t completion_capacity);
+
+  /**
+   * Accessor for the stream rings. May be called from any thread.
+   * @return Http::StreamRings*, the rings, or nullptr if initStreamRings() has not been called.
+   */
+  Http::StreamRings* streamRings();
+
   /**
    * Increment a counter with a given string of elements and by the given count.
    * @param elements, joined elements of the timeseries.
@@ -111,10 +154,20 @@ private:
   Thread::CondVar cv_;
   Http::ClientPtr http_client_;
   Event::ProvisionalDispatcherPtr dispatcher_;
+  Event::LoopLagMonitorPtr loop_lag_monitor_;
+  Http::StreamRingsPtr stream_rings_ GUARDED_BY(mutex_);
+  std::atomic<Http::StreamRings*> stream_rings_view_{};
   Logger::LambdaDelegatePtr lambda_logger_{};
   Server::Instance* server_{};
-  Server::ServerLifecycleNotifier::HandlePtr postinit_callback_handler_;
+  Server::ServerLifecycleNotifier::HandlePtr init_callback_handler_;
+  bool fast_start_{false};
+  size_t stream_stride_{1};
+  // When run() was called, read from time_system_. @see Http::Client::setEngineStartTime.
+  MonotonicTime run_time_;
+  // The only clock engine and stream latencies are measured against, @see timeSource().
+  Event::RealTimeSystem time_system_;
   std::atomic<envoy_network_t>& preferred_network_;
+  Api::External::RegistrySharedPtr api_registry_;
   // main_thread_ should be destroyed first, hence it is the last member variable. Objects with
   // instructions scheduled on the main_thread_ need to have a longer lifetime.
   std::thread main_thread_{}; // Empty placeholder to be populated later.
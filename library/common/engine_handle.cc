@@ -0,0 +1,142 @@
+#include "library/common/engine_handle.h"
+
+namespace Envoy {
+
+namespace {
+
+constexpr size_t StreamBits = sizeof(envoy_stream_t) * 8 - 1 - EngineHandle::HandleBits;
+constexpr envoy_stream_t StreamMask = (static_cast<envoy_stream_t>(1) << StreamBits) - 1;
+
+} // namespace
+
+EngineHandle::EngineHandle(envoy_engine_t handle, envoy_engine_callbacks callbacks,
+                           envoy_logger logger, std::atomic<envoy_network_t>& preferred_network,
+                           envoy_stream_t first_stream)
+    : handle_(handle), platform_callbacks_(callbacks), preferred_network_(preferred_network),
+      api_registry_(std::make_shared<Api::External::Registry>()), next_stream_(first_stream) {
+  ASSERT(handle_ > 0 && handle_ <= MaxHandle);
+  strong_primary_ = createWorker(logger);
+  primary_ = strong_primary_;
+  workers_.push_back(strong_primary_);
+}
+
+envoy_engine_t EngineHandle::handleForStream(envoy_stream_t stream) {
+  return (stream >> StreamBits) & MaxHandle;
+}
+
+envoy_stream_t EngineHandle::initStream() {
+  // The counter wraps within its bits; a collision would need a stream to outlive every stream
+  // started after it under this handle, which is 2^24 streams even on 32-bit platforms.
+  return (static_cast<envoy_stream_t>(handle_) << StreamBits) | (next_stream_++ & StreamMask);
+}
+
+envoy_status_t EngineHandle::setWorkerCount(uint32_t worker_count) {
+  if (worker_count == 0 || worker_count > MaxWorkers || running_) {
+    return ENVOY_FAILURE;
+  }
+  worker_count_ = worker_count;
+  return ENVOY_SUCCESS;
+}
+
+envoy_status_t EngineHandle::setFastStart(bool fast_start) {
+  if (running_) {
+    return ENVOY_FAILURE;
+  }
+  fast_start_ = fast_start;
+  return ENVOY_SUCCESS;
+}
+
+envoy_status_t EngineHandle::run(const std::string& config, const std::string& log_level) {
+  if (running_ || strong_primary_ == nullptr) {
+    return ENVOY_FAILURE;
+  }
+  running_ = true;
+  workers_pending_running_ = worker_count_;
+  workers_pending_exit_ = worker_count_;
+
+  // Only the primary logs to the platform, which would otherwise see every line once per worker.
+  envoy_logger worker_logger{nullptr, envoy_noop_const_release, nullptr};
+  for (uint32_t i = 1; i < worker_count_; i++) {
+    auto worker = createWorker(worker_logger);
+    if (strong_primary_->streamRings() != nullptr) {
+      worker->initStreamRings(submission_ring_capacity_, completion_ring_capacity_);
+    }
+    strong_workers_.push_back(worker);
+    workers_.push_back(worker);
+  }
+
+  strong_primary_->setFastStart(fast_start_);
+  strong_primary_->setStreamStride(worker_count_);
+  strong_primary_->run(config, log_level);
+  for (auto& worker : strong_workers_) {
+    worker->setFastStart(fast_start_);
+    worker->setStreamStride(worker_count_);
+    worker->run(config, log_level);
+  }
+  return ENVOY_SUCCESS;
+}
+
+void EngineHandle::terminate() {
+  // Drop the owning references, but retain them long enough to synchronously terminate.
+  auto primary = std::move(strong_primary_);
+  auto workers = std::move(strong_workers_);
+  strong_primary_.reset();
+  strong_workers_.clear();
+  for (auto& worker : workers) {
+    worker->terminate();
+  }
+  if (primary != nullptr) {
+    primary->terminate();
+  }
+}
+
+EngineSharedPtr EngineHandle::primary() { return primary_.lock(); }
+
+EngineSharedPtr EngineHandle::worker(envoy_stream_t stream) {
+  return workers_[workerIndex(stream)].lock();
+}
+
+size_t EngineHandle::workerIndex(envoy_stream_t stream) const {
+  // Consecutive handles go to consecutive workers. Each worker's client knows the worker count and
+  // divides its handles by it before indexing its stream map, @see Engine::setStreamStride.
+  return (stream & StreamMask) % workers_.size();
+}
+
+envoy_status_t EngineHandle::initStreamRings(size_t submission_capacity,
+                                             size_t completion_capacity) {
+  auto primary = this->primary();
+  if (primary == nullptr) {
+    return ENVOY_FAILURE;
+  }
+  submission_ring_capacity_ = submission_capacity;
+  completion_ring_capacity_ = completion_capacity;
+  for (size_t i = 1; i < workers_.size(); i++) {
+    if (auto worker = workers_[i].lock()) {
+      worker->initStreamRings(submission_capacity, completion_capacity);
+    }
+  }
+  return primary->initStreamRings(submission_capacity, completion_capacity);
+}
+
+void EngineHandle::onWorkerRunning(void* context) {
+  auto* handle = static_cast<EngineHandle*>(context);
+  if (--handle->workers_pending_running_ == 0 &&
+      handle->platform_callbacks_.on_engine_running != nullptr) {
+    handle->platform_callbacks_.on_engine_running(handle->platform_callbacks_.context);
+  }
+}
+
+void EngineHandle::onWorkerExit(void* context) {
+  auto* handle = static_cast<EngineHandle*>(context);
+  if (--handle->workers_pending_exit_ == 0 && handle->platform_callbacks_.on_exit != nullptr) {
+    handle->platform_callbacks_.on_exit(handle->platform_callbacks_.context);
+  }
+}
+
+EngineSharedPtr EngineHandle::createWorker(envoy_logger logger) {
+  envoy_engine_callbacks worker_callbacks{&EngineHandle::onWorkerRunning,
+                                          &EngineHandle::onWorkerExit, this};
+  return std::make_shared<Engine>(worker_callbacks, logger, preferred_network_, api_registry_);
+}
+
+} // namespace Envoy
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "library/common/api/external.h"
+#include "library/common/engine.h"
+#include "library/common/types/c_types.h"
+
+namespace Envoy {
+
+/**
+ * An engine as addressed through the C API by its envoy_engine_t: the primary Engine, any further
+ * workers its streams are sharded across, and the state they share. Stream handles issued by an
+ * EngineHandle carry its envoy_engine_t in their high bits, so that stream-level calls can find
+ * their engine without it being passed in.
+ */
+class EngineHandle {
+public:
+  // Stream handles keep their sign bit clear and carry the engine handle in the bits below it.
+  static constexpr size_t HandleBits = 7;
+  static constexpr envoy_engine_t MaxHandle = (1 << HandleBits) - 1;
+
+  /**
+   * @param handle, the envoy_engine_t identifying this engine, from 1 to MaxHandle.
+   * @param callbacks, the platform's engine lifecycle callbacks.
+   * @param logger, the platform's logging callbacks.
+   * @param preferred_network, hook to obtain the preferred network for new streams.
+   * @param first_stream, where stream numbering starts. When a handle is reused this continues
+   * from the previous engine's streams, so that stale stream handles do not address new streams.
+   */
+  EngineHandle(envoy_engine_t handle, envoy_engine_callbacks callbacks, envoy_logger logger,
+               std::atomic<envoy_network_t>& preferred_network, envoy_stream_t first_stream = 0);
+
+  /**
+   * @param stream, a stream handle issued by initStream().
+   * @return envoy_engine_t, the handle of the engine that issued the stream.
+   */
+  static envoy_engine_t handleForStream(envoy_stream_t stream);
+
+  /**
+   * @return envoy_engine_t, the handle identifying this engine.
+   */
+  envoy_engine_t handle() const { return handle_; }
+
+  /**
+   * @return envoy_stream_t, a new stream handle, unique within the process.
+   */
+  envoy_stream_t initStream();
+
+  /**
+   * @return envoy_stream_t, where stream numbering would continue for an engine reusing this
+   * handle.
+   */
+  envoy_stream_t nextStream() const { return next_stream_.load(); }
+
+  // Each worker is a complete Envoy server, but the logger context, the log sink delegate chain and
+  // the runtime singleton are process-wide and assume a single server that is set up and torn down
+  // in strict order. Until workers share one server, only a single worker is accepted.
+  static constexpr uint32_t MaxWorkers = 1;
+
+  /**
+   * Set the number of workers to shard streams across. Only valid before run().
+   * @param worker_count, the number of workers, from one to MaxWorkers.
+   * @return envoy_status_t, the resulting status of the operation.
+   */
+  envoy_status_t setWorkerCount(uint32_t worker_count);
+
+  /**
+   * Start every worker early, @see Engine::setFastStart. Only valid before run().
+   * @param fast_start, whether to start early.
+   * @return envoy_status_t, the resulting status of the operation.
+   */
+  envoy_status_t setFastStart(bool fast_start);
+
+  /**
+   * Run every worker with the provided configuration.
+   */
+  envoy_status_t run(const std::string& config, const std::string& log_level);
+
+  /**
+   * Synchronously terminate every worker. Calls for this engine fail from then on.
+   */
+  void terminate();
+
+  /**
+   * @return EngineSharedPtr, the primary worker, or nullptr once terminated.
+   */
+  EngineSharedPtr primary();
+
+  /**
+   * @return EngineSharedPtr, the worker a stream is pinned to, or nullptr once terminated.
+   */
+  EngineSharedPtr worker(envoy_stream_t stream);
+
+  /**
+   * @return size_t, the index of the worker a stream is pinned to.
+   */
+  size_t workerIndex(envoy_stream_t stream) const;
+
+  /**
+   * @return size_t, the number of workers streams are sharded across.
+   */
+  size_t workerCount() const { return workers_.size(); }
+
+  /**
+   * Set up stream rings on every worker. Completions from all workers land on the primary's ring.
+   */
+  envoy_status_t initStreamRings(size_t submission_capacity, size_t completion_capacity);
+
+  /**
+   * @return Api::External::Registry&, external APIs visible to this engine alone.
+   */
+  Api::External::Registry& apiRegistry() { return *api_registry_; }
+
+private:
+  // The platform is told the engine is running once every worker is, and that it has exited once
+  // every worker has.
+  static void onWorkerRunning(void* context);
+  static void onWorkerExit(void* context);
+
+  EngineSharedPtr createWorker(envoy_logger logger);
+
+  const envoy_engine_t handle_;
+  const envoy_engine_callbacks platform_callbacks_;
+  std::atomic<envoy_network_t>& preferred_network_;
+  const Api::External::RegistrySharedPtr api_registry_;
+  std::atomic<envoy_stream_t> next_stream_;
+  uint32_t worker_count_{1};
+  bool fast_start_{false};
+  bool running_{false};
+  size_t submission_ring_capacity_{0};
+  size_t completion_ring_capacity_{0};
+  std::atomic<uint32_t> workers_pending_running_{0};
+  std::atomic<uint32_t> workers_pending_exit_{0};
+  // Owning references, dropped on terminate().
+  EngineSharedPtr strong_primary_;
+  std::vector<EngineSharedPtr> strong_workers_;
+  // Set at construction, so that engine-level calls may be made before run().
+  EngineWeakPtr primary_;
+  // All workers, primary first. Fixed once run() is called; streams may only be used after that.
+  std::vector<EngineWeakPtr> workers_;
+};
+
+} // namespace Envoy
@@ -0,0 +1,113 @@
+#include "library/common/event/loop_lag_monitor.h"
+
+#include <algorithm>
+
+#include "common/common/assert.h"
+#include "common/stats/utility.h"
+
+namespace Envoy {
+namespace Event {
+
+namespace {
+// The monitor for the loop running on this thread, if any.
+thread_local LoopLagMonitor* current_monitor = nullptr;
+} // namespace
+
+LoopLagMonitor::ScopedCallback::ScopedCallback(absl::string_view kind, absl::string_view name)
+    : monitor_(current_monitor), kind_(kind), name_(name) {
+  if (monitor_) {
+    start_time_ = monitor_->dispatcher_.timeSource().monotonicTime();
+  }
+}
+
+LoopLagMonitor::ScopedCallback::~ScopedCallback() {
+  if (monitor_) {
+    const auto duration = monitor_->dispatcher_.timeSource().monotonicTime() - start_time_;
+    monitor_->recordCallback(kind_, name_,
+                             std::chrono::duration_cast<std::chrono::microseconds>(duration));
+  }
+}
+
+LoopLagMonitor::LoopLagMonitor(Dispatcher& dispatcher, Stats::Scope& scope,
+                               std::chrono::milliseconds interval, size_t max_slow_callbacks)
+    : dispatcher_(dispatcher), scope_(scope),
+      stats_(LoopLagMonitorStats{
+          ALL_LOOP_LAG_MONITOR_STATS(POOL_HISTOGRAM_PREFIX(scope, "dispatcher."))}),
+      interval_(interval), max_slow_callbacks_(max_slow_callbacks),
+      timer_(dispatcher.createTimer([this]() -> void { onTimer(); })) {
+  ASSERT(current_monitor == nullptr, "only one LoopLagMonitor may run per thread");
+  // Without slow callback tracking ScopedCallback has nothing to report, so it is left disabled.
+  if (max_slow_callbacks_ > 0) {
+    current_monitor = this;
+  }
+  arm();
+}
+
+LoopLagMonitor::~LoopLagMonitor() {
+  if (current_monitor == this) {
+    current_monitor = nullptr;
+  }
+}
+
+void LoopLagMonitor::arm() {
+  deadline_ = dispatcher_.timeSource().monotonicTime() + interval_;
+  timer_->enableTimer(interval_);
+}
+
+void LoopLagMonitor::onTimer() {
+  const auto lag = dispatcher_.timeSource().monotonicTime() - deadline_;
+  stats_.loop_lag_us_.recordValue(
+      std::max<int64_t>(0, std::chrono::duration_cast<std::chrono::microseconds>(lag).count()));
+  arm();
+}
+
+void LoopLagMonitor::recordCallback(absl::string_view kind, absl::string_view name,
+                                    std::chrono::microseconds duration) {
+  callbackHistogram(kind, name).recordValue(duration.count());
+
+  // Most callbacks are faster than the slowest already kept, so this is the common path.
+  if (slow_callbacks_.size() == max_slow_callbacks_ &&
+      duration <= slow_callbacks_.back().duration_) {
+    return;
+  }
+
+  // callbackHistogram left this callback's origin in origin_.
+  std::string origin = origin_;
+  ENVOY_LOG(debug, "slow event loop callback {} ran for {}us", origin, duration.count());
+  auto position = std::upper_bound(
+      slow_callbacks_.begin(), slow_callbacks_.end(), duration,
+      [](std::chrono::microseconds value, const SlowCallback& slow_callback) -> bool {
+        return value > slow_callback.duration_;
+      });
+  slow_callbacks_.insert(position, SlowCallback{std::move(origin), duration});
+  if (slow_callbacks_.size() > max_slow_callbacks_) {
+    slow_callbacks_.pop_back();
+  }
+}
+
+Stats::Histogram& LoopLagMonitor::callbackHistogram(absl::string_view kind,
+                                                    absl::string_view name) {
+  origin_.assign(kind.data(), kind.size());
+  if (!name.empty()) {
+    origin_.push_back(':');
+    origin_.append(name.data(), name.size());
+  }
+  auto it = callback_histograms_.find(origin_);
+  if (it != callback_histograms_.end()) {
+    return *it->second;
+  }
+
+  Stats::ElementVec elements{Stats::DynamicName("dispatcher"), Stats::DynamicName("callback"),
+                             Stats::DynamicName(kind)};
+  if (!name.empty()) {
+    elements.push_back(Stats::DynamicName(name));
+  }
+  elements.push_back(Stats::DynamicName("duration_us"));
+  Stats::Histogram& histogram = Stats::Utility::histogramFromElements(
+      scope_, elements, Stats::Histogram::Unit::Microseconds);
+  callback_histograms_.emplace(origin_, &histogram);
+  return histogram;
+}
+
+} // namespace Event
+} // namespace Envoy
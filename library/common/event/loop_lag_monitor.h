@@ -0,0 +1,114 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "envoy/common/time.h"
+#include "envoy/event/dispatcher.h"
+#include "envoy/event/timer.h"
+#include "envoy/stats/scope.h"
+#include "envoy/stats/stats_macros.h"
+
+#include "common/common/logger.h"
+#include "common/common/non_copyable.h"
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+
+namespace Envoy {
+namespace Event {
+
+/**
+ * All loop lag monitor stats. @see stats_macros.h
+ */
+#define ALL_LOOP_LAG_MONITOR_STATS(HISTOGRAM) HISTOGRAM(loop_lag_us, Microseconds)
+
+/**
+ * Struct definition for loop lag monitor stats. @see stats_macros.h
+ * loop_lag_us measures how late the event loop ran each sampling timer. While slow callbacks are
+ * tracked, each origin additionally gets a dispatcher.callback.<kind>[.<name>].duration_us
+ * histogram of how long its callbacks ran.
+ */
+struct LoopLagMonitorStats {
+  ALL_LOOP_LAG_MONITOR_STATS(GENERATE_HISTOGRAM_STRUCT)
+};
+
+/**
+ * Samples the scheduling delay of an event loop with a periodic timer: however long the timer
+ * fires past its deadline, some other work held up the loop. Optionally keeps the slowest
+ * callbacks that ran on the loop, labelled with their origin, to point at the work responsible.
+ *
+ * Must be created, used and destroyed on the dispatcher's thread. While it exists, it is the
+ * monitor ScopedCallback reports to on that thread.
+ */
+class LoopLagMonitor : NonCopyable, public Logger::Loggable<Logger::Id::main> {
+public:
+  struct SlowCallback {
+    std::string origin_;
+    std::chrono::microseconds duration_;
+  };
+
+  /**
+   * Times a callback running on the current thread's monitored loop, attributing it to an origin
+   * such as a platform filter. A no-op on threads without a monitor, or when the monitor is not
+   * tracking slow callbacks.
+   */
+  class ScopedCallback : NonCopyable {
+  public:
+    /**
+     * @param kind, the kind of work, e.g. "platform_filter".
+     * @param name, optionally which instance of that kind, e.g. the filter's name. Must outlive
+     * this object.
+     */
+    explicit ScopedCallback(absl::string_view kind, absl::string_view name = "");
+    ~ScopedCallback();
+
+  private:
+    LoopLagMonitor* const monitor_;
+    const absl::string_view kind_;
+    const absl::string_view name_;
+    MonotonicTime start_time_;
+  };
+
+  /**
+   * @param dispatcher, the dispatcher whose loop is sampled.
+   * @param scope, the scope stats are created in, under "dispatcher.".
+   * @param interval, how often the loop is sampled.
+   * @param max_slow_callbacks, how many of the slowest callbacks to keep. 0 disables tracking.
+   */
+  LoopLagMonitor(Dispatcher& dispatcher, Stats::Scope& scope, std::chrono::milliseconds interval,
+                 size_t max_slow_callbacks);
+  ~LoopLagMonitor();
+
+  /**
+   * @return the slowest callbacks seen so far, slowest first.
+   */
+  const std::vector<SlowCallback>& slowestCallbacks() const { return slow_callbacks_; }
+
+private:
+  void onTimer();
+  void arm();
+  void recordCallback(absl::string_view kind, absl::string_view name,
+                      std::chrono::microseconds duration);
+  Stats::Histogram& callbackHistogram(absl::string_view kind, absl::string_view name);
+
+  Dispatcher& dispatcher_;
+  Stats::Scope& scope_;
+  LoopLagMonitorStats stats_;
+  const std::chrono::milliseconds interval_;
+  const size_t max_slow_callbacks_;
+  TimerPtr timer_;
+  MonotonicTime deadline_;
+  // Sorted slowest first, and at most max_slow_callbacks_ long.
+  std::vector<SlowCallback> slow_callbacks_;
+  // Duration histograms by origin, and scratch space for building an origin to look one up.
+  absl::flat_hash_map<std::string, Stats::Histogram*> callback_histograms_;
+  std::string origin_;
+};
+
+using LoopLagMonitorPtr = std::unique_ptr<LoopLagMonitor>;
+
+} // namespace Event
+} // namespace Envoy
@@ -1,5 +1,8 @@
 #include "library/common/event/provisional_dispatcher.h"
 
+#include <algorithm>
+#include <chrono>
+
 #include "common/common/lock_guard.h"
 
 #include "library/common/thread/lock_guard.h"
@@ -11,36 +14,109 @@ void ProvisionalDispatcher::drain(Event::Dispatcher& event_dispatcher) {
   // TODO(goaway): Must be called from the Event::Dispatcher's thread, but we can't assert here
   // because of behavioral oddities in Event::Dispatcher: event_dispatcher_->isThreadSafe() will
   // crash.
-  Thread::LockGuard lock(state_lock_);
   ENVOY_LOG(trace, "ProvisionalDispatcher::drain");
-  RELEASE_ASSERT(!drained_, "ProvisionalDispatcher::drain must only occur once");
-  drained_ = true;
+  RELEASE_ASSERT(!drained_.load(), "ProvisionalDispatcher::drain must only occur once");
   event_dispatcher_ = &event_dispatcher;
+  // A post that observes drained_ as false relies on this flush to run its callback, so drained_
+  // must be published before scheduling.
+  drained_.store(true);
+  scheduleFlush();
+}
 
-  for (const Event::PostCb& cb : init_queue_) {
-    event_dispatcher_->post(cb);
-  }
+void ProvisionalDispatcher::initializeStats(Stats::Scope& scope) {
+  stats_ = std::make_unique<ProvisionalDispatcherStats>(ProvisionalDispatcherStats{
+      ALL_PROVISIONAL_DISPATCHER_STATS(POOL_GAUGE_PREFIX(scope, "dispatcher."),
+                                       POOL_HISTOGRAM_PREFIX(scope, "dispatcher."))});
 }
 
 envoy_status_t ProvisionalDispatcher::post(Event::PostCb callback) {
-  Thread::LockGuard lock(state_lock_);
+  ENVOY_LOG(trace, "ProvisionalDispatcher::post");
+  // Posts may come from any thread, before any TimeSource exists, so the steady clock is read
+  // directly, here and when the callback runs.
+  const MonotonicTime post_time = std::chrono::steady_clock::now(); // NO_CHECK_FORMAT(real_time)
+  QueuedCallback queued{std::move(callback), post_time};
+  const uint64_t depth = depth_.fetch_add(1) + 1;
+  uint64_t max_depth = max_depth_.load();
+  while (depth > max_depth && !max_depth_.compare_exchange_weak(max_depth, depth)) {
+    // max_depth now holds the latest maximum; retry while ours is still larger.
+  }
 
-  if (drained_) {
-    ENVOY_LOG(trace, "ProvisionalDispatcher::post: pass-through");
-    event_dispatcher_->post(callback);
-    return ENVOY_SUCCESS;
+  if (overflowed_.load() || !queue_.push(queued)) {
+    Thread::LockGuard lock(overflow_lock_);
+    overflow_queue_.push_back(std::move(queued));
+    overflowed_.store(true);
   }
 
-  ENVOY_LOG(trace, "ProvisionalDispatcher::post: queueing");
-  init_queue_.push_back(callback);
+  // Before drain(), callbacks simply accumulate until drain() schedules the first flush.
+  if (drained_.load()) {
+    scheduleFlush();
+  }
   return ENVOY_SUCCESS;
 }
 
+void ProvisionalDispatcher::scheduleFlush() {
+  if (!flush_scheduled_.exchange(true)) {
+    event_dispatcher_->post([this]() -> void { flush(); });
+  }
+}
+
+void ProvisionalDispatcher::flush() {
+  // Cleared before draining, so that a post whose callback is missed by the loop below is
+  // guaranteed to schedule another flush.
+  flush_scheduled_.store(false);
+
+  // Bound the work done per flush so that a steady stream of posts cannot starve other events.
+  size_t budget = queue_.capacity();
+  QueuedCallback queued;
+  while (budget > 0 && queue_.pop(queued)) {
+    budget--;
+    run(queued);
+  }
+  bool reschedule = budget == 0;
+
+  if (overflowed_.load()) {
+    std::list<QueuedCallback> overflow;
+    {
+      Thread::LockGuard lock(overflow_lock_);
+      // Overflowed callbacks may only run once every callback that entered queue_ ahead of them
+      // has, including any whose push is still in flight.
+      if (queue_.empty()) {
+        overflow.swap(overflow_queue_);
+        overflowed_.store(false);
+      }
+    }
+    reschedule |= overflow.empty();
+    for (const QueuedCallback& overflowed : overflow) {
+      run(overflowed);
+    }
+  }
+
+  if (stats_) {
+    // The peak restarts from the current depth, so that each snapshot covers only its own span.
+    const uint64_t depth = depth_.load();
+    stats_->queue_depth_.set(depth);
+    stats_->max_queue_depth_.set(std::max(max_depth_.exchange(depth), depth));
+  }
+
+  if (reschedule) {
+    scheduleFlush();
+  }
+}
+
+void ProvisionalDispatcher::run(const QueuedCallback& queued) {
+  if (stats_) {
+    const MonotonicTime now = std::chrono::steady_clock::now(); // NO_CHECK_FORMAT(real_time)
+    stats_->post_latency_us_.recordValue(
+        std::chrono::duration_cast<std::chrono::microseconds>(now - queued.post_time_).count());
+  }
+  depth_--;
+  queued.callback_();
+}
+
 bool ProvisionalDispatcher::isThreadSafe() {
-  // Doesn't require locking because if a thread has a stale view of drained_, then by definition
-  // this wasn't a threadsafe call.
+  // A thread with a stale view of drained_ was by definition not making a threadsafe call.
   ENVOY_LOG(trace, "ProvisionalDispatcher::isThreadSafe");
-  return TS_UNCHECKED_READ(drained_) && event_dispatcher_->isThreadSafe();
+  return drained_.load(std::memory_order_acquire) && event_dispatcher_->isThreadSafe();
 }
 
 void ProvisionalDispatcher::deferredDelete(DeferredDeletablePtr&& to_delete) {
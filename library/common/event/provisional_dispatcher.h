@@ -1,16 +1,43 @@
 #pragma once
 
+#include <atomic>
+#include <list>
+#include <memory>
+
+#include "envoy/common/time.h"
 #include "envoy/event/deferred_deletable.h"
 #include "envoy/event/dispatcher.h"
+#include "envoy/stats/scope.h"
+#include "envoy/stats/stats_macros.h"
 
 #include "common/common/logger.h"
 #include "common/common/thread_synchronizer.h"
 
+#include "library/common/thread/bounded_queue.h"
 #include "library/common/types/c_types.h"
 
 namespace Envoy {
 namespace Event {
 
+/**
+ * All provisional dispatcher stats. @see stats_macros.h
+ */
+#define ALL_PROVISIONAL_DISPATCHER_STATS(GAUGE, HISTOGRAM)                                         \
+  GAUGE(queue_depth, Accumulate)                                                                   \
+  GAUGE(max_queue_depth, Accumulate)                                                               \
+  HISTOGRAM(post_latency_us, Microseconds)
+
+/**
+ * Struct definition for provisional dispatcher stats. @see stats_macros.h
+ * queue_depth and max_queue_depth are snapshots taken each time queued callbacks are run on the
+ * event dispatcher's thread, rather than updated on every post: queue_depth counts the callbacks
+ * still posted but not yet run, and max_queue_depth the most there were at once since the previous
+ * snapshot. post_latency_us measures how long each callback waited between post() and running.
+ */
+struct ProvisionalDispatcherStats {
+  ALL_PROVISIONAL_DISPATCHER_STATS(GENERATE_GAUGE_STRUCT, GENERATE_HISTOGRAM_STRUCT)
+};
+
 /**
  * Wrapper around Envoy's Event::Dispatcher that queues callbacks until drain() is called. Future
  * versions may support correct calling semantics after the Event::Dispatcher has been
@@ -27,6 +54,14 @@ public:
    */
   virtual void drain(Event::Dispatcher& event_dispatcher);
 
+  /**
+   * Starts reporting queue stats under "dispatcher." in the given scope. Callbacks posted before
+   * this is called, including those queued before drain(), are still measured once they run.
+   * Must be called before drain(), on the event dispatcher's thread.
+   * @param scope, the scope stats are created in.
+   */
+  void initializeStats(Stats::Scope& scope);
+
   // TODO(goaway): return ENVOY_FAILURE after the underlying dispatcher has exited.
   /**
    * Before the Event::Dispatcher is running, queues posted callbacks; afterwards passes them
@@ -53,11 +88,38 @@ public:
   Thread::ThreadSynchronizer& synchronizer() { return synchronizer_; }
 
 private:
-  // TODO(goaway): This class supports a straightforward case-specific lock-free implementation, but
-  // uses heavyweight synchronization for expediency at present.
-  Thread::MutexBasicLockable state_lock_;
-  bool drained_ GUARDED_BY(state_lock_){};
-  std::list<Event::PostCb> init_queue_ GUARDED_BY(state_lock_);
+  // A posted callback, with the time it was posted at.
+  struct QueuedCallback {
+    Event::PostCb callback_;
+    MonotonicTime post_time_;
+  };
+
+  // Number of callbacks that can be queued before posts fall back to the locked overflow list.
+  static constexpr size_t QueueCapacity = 1024;
+
+  // Schedules a flush on the event dispatcher, unless one is already pending.
+  void scheduleFlush();
+  // Runs queued callbacks. Runs on the event dispatcher's thread.
+  void flush();
+  // Runs a single queued callback and accounts for it in stats.
+  void run(const QueuedCallback& queued);
+
+  // Callbacks are queued without locking or allocation both before and after drain(). Once drained,
+  // a single event dispatcher post is made per batch of callbacks rather than one per callback.
+  Thread::BoundedQueue<QueuedCallback> queue_{QueueCapacity};
+  // Callbacks posted while queue_ was full. While any are pending, every post goes here so that
+  // each posting thread's callbacks still run in order.
+  Thread::MutexBasicLockable overflow_lock_;
+  std::list<QueuedCallback> overflow_queue_ GUARDED_BY(overflow_lock_);
+  std::atomic<bool> overflowed_{};
+  std::atomic<bool> drained_{};
+  std::atomic<bool> flush_scheduled_{};
+  // Callbacks posted but not yet run, and the most there have been at once since the last stats
+  // snapshot.
+  std::atomic<uint64_t> depth_{};
+  std::atomic<uint64_t> max_depth_{};
+  // Only accessed on the event dispatcher's thread.
+  std::unique_ptr<ProvisionalDispatcherStats> stats_;
   Event::Dispatcher* event_dispatcher_{};
   Thread::ThreadSynchronizer synchronizer_;
 };
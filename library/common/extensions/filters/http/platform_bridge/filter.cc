@@ -9,6 +9,7 @@
 #include "library/common/api/external.h"
 #include "library/common/buffer/bridge_fragment.h"
 #include "library/common/data/utility.h"
+#include "library/common/event/loop_lag_monitor.h"
 #include "library/common/extensions/filters/http/platform_bridge/c_type_definitions.h"
 #include "library/common/http/header_utility.h"
 #include "library/common/http/headers.h"
@@ -162,8 +163,11 @@ Http::FilterHeadersStatus PlatformBridgeFilter::FilterBase::onHeaders(Http::Head
 
   envoy_headers in_headers = Http::Utility::toBridgeHeaders(headers);
   ENVOY_LOG(trace, "PlatformBridgeFilter({})->on_*_headers", parent_.filter_name_);
-  envoy_filter_headers_status result =
-      on_headers_(in_headers, end_stream, parent_.platform_filter_.instance_context);
+  envoy_filter_headers_status result;
+  {
+    Event::LoopLagMonitor::ScopedCallback tracked("platform_filter", parent_.filter_name_);
+    result = on_headers_(in_headers, end_stream, parent_.platform_filter_.instance_context);
+  }
 
   switch (result.status) {
   case kEnvoyFilterHeadersStatusContinue:
@@ -207,8 +211,11 @@ Http::FilterDataStatus PlatformBridgeFilter::FilterBase::onData(Buffer::Instance
   }
 
   ENVOY_LOG(trace, "PlatformBridgeFilter({})->on_*_data", parent_.filter_name_);
-  envoy_filter_data_status result =
-      on_data_(in_data, end_stream, parent_.platform_filter_.instance_context);
+  envoy_filter_data_status result;
+  {
+    Event::LoopLagMonitor::ScopedCallback tracked("platform_filter", parent_.filter_name_);
+    result = on_data_(in_data, end_stream, parent_.platform_filter_.instance_context);
+  }
 
   switch (result.status) {
   case kEnvoyFilterDataStatusContinue:
@@ -285,8 +292,11 @@ Http::FilterTrailersStatus PlatformBridgeFilter::FilterBase::onTrailers(Http::He
   auto internal_buffer = buffer();
   envoy_headers in_trailers = Http::Utility::toBridgeHeaders(trailers);
   ENVOY_LOG(trace, "PlatformBridgeFilter({})->on_*_trailers", parent_.filter_name_);
-  envoy_filter_trailers_status result =
-      on_trailers_(in_trailers, parent_.platform_filter_.instance_context);
+  envoy_filter_trailers_status result;
+  {
+    Event::LoopLagMonitor::ScopedCallback tracked("platform_filter", parent_.filter_name_);
+    result = on_trailers_(in_trailers, parent_.platform_filter_.instance_context);
+  }
 
   switch (result.status) {
   case kEnvoyFilterTrailersStatusContinue:
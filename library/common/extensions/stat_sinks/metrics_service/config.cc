@@ -29,9 +29,7 @@ Stats::SinkPtr EnvoyMobileMetricsServiceSinkFactory::createStatsSink(
               grpc_service, server.scope(), false),
           server.localInfo(), server.api().randomGenerator());
 
-  return std::make_unique<MetricsService::MetricsServiceSink<
-      envoymobile::extensions::stat_sinks::metrics_service::EnvoyMobileStreamMetricsMessage,
-      envoymobile::extensions::stat_sinks::metrics_service::EnvoyMobileStreamMetricsResponse>>(
+  return std::make_unique<EnvoyMobileMetricsServiceSink>(
       grpc_metrics_streamer,
       PROTOBUF_GET_WRAPPED_OR_DEFAULT(sink_config, report_counters_as_deltas, false),
       sink_config.emit_tags_as_labels());
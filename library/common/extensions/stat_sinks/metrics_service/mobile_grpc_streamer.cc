@@ -2,6 +2,8 @@
 
 #include "extensions/stat_sinks/metrics_service/grpc_metrics_service_impl.h"
 
+#include "library/common/event/loop_lag_monitor.h"
+
 namespace Envoy {
 namespace Extensions {
 namespace StatSinks {
@@ -43,6 +45,11 @@ void EnvoyMobileGrpcMetricsStreamerImpl::onReceiveMessage(
   ENVOY_LOG(debug, "EnvoyMobile streamer received batch_id: {}", response->batch_id());
 }
 
+void EnvoyMobileMetricsServiceSink::flush(Stats::MetricSnapshot& snapshot) {
+  Event::LoopLagMonitor::ScopedCallback tracked("stats_flush");
+  MetricsServiceSink::flush(snapshot);
+}
+
 } // namespace EnvoyMobileMetricsService
 } // namespace StatSinks
 } // namespace Extensions
@@ -51,6 +51,21 @@ private:
 
 using EnvoyMobileGrpcMetricsStreamerImplPtr = std::unique_ptr<EnvoyMobileGrpcMetricsStreamerImpl>;
 
+/**
+ * EnvoyMobile MetricsServiceSink, which attributes the whole of each flush, from converting the
+ * snapshot to sending it, to "stats_flush" in the event loop's slow callback tracking.
+ */
+class EnvoyMobileMetricsServiceSink
+    : public MetricsService::MetricsServiceSink<
+          envoymobile::extensions::stat_sinks::metrics_service::EnvoyMobileStreamMetricsMessage,
+          envoymobile::extensions::stat_sinks::metrics_service::EnvoyMobileStreamMetricsResponse> {
+public:
+  using MetricsServiceSink::MetricsServiceSink;
+
+  // Stats::Sink
+  void flush(Stats::MetricSnapshot& snapshot) override;
+};
+
 } // namespace EnvoyMobileMetricsService
 } // namespace StatSinks
 } // namespace Extensions
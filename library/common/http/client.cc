@@ -1,5 +1,8 @@
 #include "library/common/http/client.h"
 
+#include <algorithm>
+#include <chrono>
+
 #include "common/buffer/buffer_impl.h"
 #include "common/common/lock_guard.h"
 #include "common/http/codes.h"
@@ -29,10 +32,18 @@ Client::DirectStreamCallbacks::DirectStreamCallbacks(DirectStream& direct_stream
     : direct_stream_(direct_stream), bridge_callbacks_(bridge_callbacks),
       http_client_(http_client) {}
 
+Client::DirectStreamCallbacks::~DirectStreamCallbacks() {
+  // Trailers held for a stream that was cancelled before they could be delivered.
+  if (response_trailers_) {
+    release_envoy_headers(response_trailers_.value());
+  }
+}
+
 void Client::DirectStreamCallbacks::encodeHeaders(const ResponseHeaderMap& headers,
                                                   bool end_stream) {
   ENVOY_LOG(debug, "[S{}] response headers for stream (end_stream={}):\n{}",
             direct_stream_.stream_handle_, end_stream, headers);
+  direct_stream_.response_headers_time_ = http_client_.time_source_.monotonicTime();
 
   ASSERT(http_client_.getStream(direct_stream_.stream_handle_));
   if (end_stream) {
@@ -41,6 +52,19 @@ void Client::DirectStreamCallbacks::encodeHeaders(const ResponseHeaderMap& heade
 
   uint64_t response_status = Utility::getResponseStatus(headers);
 
+  uint32_t attempt_count;
+  if (headers.EnvoyAttemptCount() &&
+      absl::SimpleAtoi(headers.EnvoyAttemptCount()->value().getStringView(), &attempt_count)) {
+    attempt_count_ = attempt_count;
+  }
+  uint64_t upstream_service_time;
+  const auto upstream_service_time_header = headers.get(Headers::get().EnvoyUpstreamServiceTime);
+  if (!upstream_service_time_header.empty() &&
+      absl::SimpleAtoi(upstream_service_time_header[0]->value().getStringView(),
+                       &upstream_service_time)) {
+    upstream_service_time_ms_ = upstream_service_time;
+  }
+
   // Presence of internal error header indicates an error that should be surfaced as an
   // error callback (rather than an HTTP response).
   const auto error_code_header = headers.get(InternalHeaders::get().ErrorCode);
@@ -57,12 +81,6 @@ void Client::DirectStreamCallbacks::encodeHeaders(const ResponseHeaderMap& heade
           Data::Utility::copyToBridgeData(error_message_header[0]->value().getStringView());
     }
 
-    uint32_t attempt_count;
-    if (headers.EnvoyAttemptCount() &&
-        absl::SimpleAtoi(headers.EnvoyAttemptCount()->value().getStringView(), &attempt_count)) {
-      error_attempt_count_ = attempt_count;
-    }
-
     if (end_stream) {
       onError();
     }
@@ -87,8 +105,18 @@ void Client::DirectStreamCallbacks::encodeHeaders(const ResponseHeaderMap& heade
 void Client::DirectStreamCallbacks::encodeData(Buffer::Instance& data, bool end_stream) {
   ENVOY_LOG(debug, "[S{}] response data for stream (length={} end_stream={})",
             direct_stream_.stream_handle_, data.length(), end_stream);
+  direct_stream_.last_response_data_time_ = http_client_.time_source_.monotonicTime();
+  direct_stream_.received_byte_count_ += data.length();
+  if (!direct_stream_.first_response_data_time_) {
+    direct_stream_.first_response_data_time_ = direct_stream_.last_response_data_time_;
+  }
 
   ASSERT(http_client_.getStream(direct_stream_.stream_handle_));
+  if (direct_stream_.explicit_flow_control_ && !error_code_) {
+    bufferData(data, end_stream);
+    return;
+  }
+
   if (end_stream) {
     closeStream();
   }
@@ -98,6 +126,13 @@ void Client::DirectStreamCallbacks::encodeData(Buffer::Instance& data, bool end_
     return;
   }
 
+  sendDataToBridge(data, end_stream);
+  if (end_stream) {
+    onComplete();
+  }
+}
+
+void Client::DirectStreamCallbacks::sendDataToBridge(Buffer::Instance& data, bool end_stream) {
   // Testing hook.
   if (end_stream) {
     http_client_.synchronizer_.syncPoint("dispatch_encode_final_data");
@@ -106,10 +141,90 @@ void Client::DirectStreamCallbacks::encodeData(Buffer::Instance& data, bool end_
   ENVOY_LOG(debug,
             "[S{}] dispatching to platform response data for stream (length={} end_stream={})",
             direct_stream_.stream_handle_, data.length(), end_stream);
-  bridge_callbacks_.on_data(Data::Utility::toBridgeData(data), end_stream,
-                            bridge_callbacks_.context);
+  if (bridge_callbacks_.on_data_vector) {
+    bridge_callbacks_.on_data_vector(Data::Utility::toBridgeDataVector(data), end_stream,
+                                     bridge_callbacks_.context);
+  } else {
+    bridge_callbacks_.on_data(Data::Utility::toBridgeData(data), end_stream,
+                              bridge_callbacks_.context);
+  }
+}
+
+void Client::DirectStreamCallbacks::bufferData(Buffer::Instance& data, bool end_stream) {
+  response_data_.move(data);
+  if (end_stream) {
+    // Envoy is done with the stream, but it stays open for reads until everything is delivered.
+    direct_stream_.remote_end_stream_received_ = true;
+  }
+  ENVOY_LOG(debug, "[S{}] buffered response data for stream (length={} end_stream={})",
+            direct_stream_.stream_handle_, response_data_.length(), end_stream);
+
+  // A bare end of stream has no data to wait for a read window over.
+  if (bytes_to_send_ > 0 || (end_stream && response_data_.length() == 0)) {
+    sendBufferedData();
+  } else {
+    updateWatermarks();
+  }
+}
+
+void Client::DirectStreamCallbacks::resumeData(size_t bytes_to_send) {
+  ASSERT(direct_stream_.explicit_flow_control_);
+  bytes_to_send_ = bytes_to_send;
+  sendBufferedData();
+}
+
+void Client::DirectStreamCallbacks::sendBufferedData() {
+  const uint64_t length = std::min<uint64_t>(bytes_to_send_, response_data_.length());
+  const bool end_stream = direct_stream_.remote_end_stream_received_ && !response_trailers_ &&
+                          length == response_data_.length();
+  if (length == 0 && !end_stream) {
+    // Nothing to deliver yet; the window stays open until data arrives.
+    return;
+  }
+
+  Buffer::OwnedImpl data;
+  data.move(response_data_, length);
+  bytes_to_send_ = 0;
+  updateWatermarks();
+
+  if (end_stream) {
+    closeStream();
+  }
+  sendDataToBridge(data, end_stream);
   if (end_stream) {
     onComplete();
+    return;
+  }
+
+  if (response_trailers_ && response_data_.length() == 0) {
+    closeStream();
+    ENVOY_LOG(debug, "[S{}] dispatching to platform buffered response trailers for stream",
+              direct_stream_.stream_handle_);
+    envoy_headers trailers = response_trailers_.value();
+    response_trailers_.reset();
+    bridge_callbacks_.on_trailers(trailers, bridge_callbacks_.context);
+    onComplete();
+  }
+}
+
+void Client::DirectStreamCallbacks::updateWatermarks() {
+  // Once the response has ended Envoy no longer reads for this stream, so there is nothing to push
+  // back on, and raising the watermark now would never be matched by lowering it.
+  if (direct_stream_.remote_end_stream_received_) {
+    return;
+  }
+
+  // Pushing back on Envoy makes the router stop reading from the upstream, which in turn stops
+  // window updates from being sent to an HTTP/2 upstream.
+  const uint64_t high_watermark = direct_stream_.bufferLimit();
+  if (!above_high_watermark_ && response_data_.length() > high_watermark) {
+    above_high_watermark_ = true;
+    ENVOY_LOG(debug, "[S{}] response buffer above high watermark", direct_stream_.stream_handle_);
+    direct_stream_.runHighWatermarkCallbacks();
+  } else if (above_high_watermark_ && response_data_.length() <= high_watermark / 2) {
+    above_high_watermark_ = false;
+    ENVOY_LOG(debug, "[S{}] response buffer below low watermark", direct_stream_.stream_handle_);
+    direct_stream_.runLowWatermarkCallbacks();
   }
 }
 
@@ -118,6 +233,13 @@ void Client::DirectStreamCallbacks::encodeTrailers(const ResponseTrailerMap& tra
             trailers);
 
   ASSERT(http_client_.getStream(direct_stream_.stream_handle_));
+  if (direct_stream_.explicit_flow_control_ && response_data_.length() > 0) {
+    // Trailers are delivered once the platform has read all of the data ahead of them.
+    direct_stream_.remote_end_stream_received_ = true;
+    response_trailers_ = Utility::toBridgeHeaders(trailers);
+    return;
+  }
+
   closeStream(); // Trailers always indicate the end of the stream.
 
   ENVOY_LOG(debug, "[S{}] dispatching to platform response trailers for stream:\n{}",
@@ -132,14 +254,48 @@ void Client::DirectStreamCallbacks::closeStream() {
   http_client_.removeStream(direct_stream_.stream_handle_);
 }
 
+void Client::DirectStreamCallbacks::recordLatency() {
+  const MonotonicTime origin = direct_stream_.api_call_time_.value_or(direct_stream_.start_time_);
+  const MonotonicTime terminal_time = http_client_.time_source_.monotonicTime();
+  auto offset = [origin](absl::optional<MonotonicTime> time) -> int64_t {
+    if (!time) {
+      return -1;
+    }
+    return std::chrono::duration_cast<std::chrono::microseconds>(time.value() - origin).count();
+  };
+  envoy_stream_timings timings{offset(direct_stream_.start_time_),
+                               offset(direct_stream_.response_headers_time_),
+                               offset(direct_stream_.first_response_data_time_),
+                               offset(direct_stream_.last_response_data_time_),
+                               offset(terminal_time)};
+
+  const HttpClientStats& stats = http_client_.stats();
+  if (direct_stream_.api_call_time_) {
+    stats.stream_dispatch_latency_.recordValue(timings.stream_start_us);
+  }
+  if (timings.response_headers_us >= 0) {
+    stats.stream_headers_latency_.recordValue(timings.response_headers_us);
+  }
+  if (timings.first_response_data_us >= 0) {
+    stats.stream_first_data_latency_.recordValue(timings.first_response_data_us);
+    stats.stream_last_data_latency_.recordValue(timings.last_response_data_us);
+  }
+  stats.stream_total_latency_.recordValue(timings.terminal_us);
+
+  if (bridge_callbacks_.on_stream_timings) {
+    bridge_callbacks_.on_stream_timings(timings, bridge_callbacks_.context);
+  }
+}
+
 void Client::DirectStreamCallbacks::onComplete() {
   ENVOY_LOG(debug, "[S{}] complete stream (success={})", direct_stream_.stream_handle_, success_);
+  recordLatency();
   if (success_) {
     http_client_.stats().stream_success_.inc();
   } else {
     http_client_.stats().stream_failure_.inc();
   }
-  bridge_callbacks_.on_complete(bridge_callbacks_.context);
+  bridge_callbacks_.on_complete(streamIntel(), bridge_callbacks_.context);
 }
 
 void Client::DirectStreamCallbacks::onError() {
@@ -150,7 +306,7 @@ void Client::DirectStreamCallbacks::onError() {
   ASSERT(!http_client_.getStream(direct_stream_.stream_handle_));
   envoy_error_code_t code = error_code_.value_or(ENVOY_STREAM_RESET);
   envoy_data message = error_message_.value_or(envoy_nodata);
-  int32_t attempt_count = error_attempt_count_.value_or(-1);
+  int32_t attempt_count = attempt_count_.value_or(-1);
 
   // Testing hook.
   http_client_.synchronizer_.syncPoint("dispatch_on_error");
@@ -158,20 +314,55 @@ void Client::DirectStreamCallbacks::onError() {
   ENVOY_LOG(debug, "[S{}] dispatching to platform remote reset stream",
             direct_stream_.stream_handle_);
   http_client_.stats().stream_failure_.inc();
-  bridge_callbacks_.on_error({code, message, attempt_count}, bridge_callbacks_.context);
+  recordLatency();
+  bridge_callbacks_.on_error({code, message, attempt_count}, streamIntel(),
+                             bridge_callbacks_.context);
+}
+
+void Client::DirectStreamCallbacks::onSendWindowAvailable() {
+  ENVOY_LOG(debug, "[S{}] dispatching to platform send window available",
+            direct_stream_.stream_handle_);
+  if (bridge_callbacks_.on_send_window_available) {
+    bridge_callbacks_.on_send_window_available(bridge_callbacks_.context);
+  }
 }
 
 void Client::DirectStreamCallbacks::onCancel() {
   ENVOY_LOG(debug, "[S{}] dispatching to platform cancel stream", direct_stream_.stream_handle_);
   http_client_.stats().stream_cancel_.inc();
-  bridge_callbacks_.on_cancel(bridge_callbacks_.context);
+  recordLatency();
+  bridge_callbacks_.on_cancel(streamIntel(), bridge_callbacks_.context);
 }
 
-Client::DirectStream::DirectStream(envoy_stream_t stream_handle, Client& http_client)
-    : stream_handle_(stream_handle), parent_(http_client) {}
+envoy_stream_intel Client::DirectStreamCallbacks::streamIntel() const {
+  return {attempt_count_.value_or(-1), upstream_service_time_ms_.value_or(-1),
+          static_cast<int64_t>(direct_stream_.sent_byte_count_),
+          static_cast<int64_t>(direct_stream_.received_byte_count_)};
+}
+
+Client::DirectStream::DirectStream(envoy_stream_t stream_handle,
+                                   envoy_http_callbacks bridge_callbacks, Client& http_client)
+    : stream_handle_(stream_handle), parent_(http_client),
+      callbacks_(*this, bridge_callbacks, http_client) {}
 
 Client::DirectStream::~DirectStream() { ENVOY_LOG(debug, "[S{}] destroy stream", stream_handle_); }
 
+namespace {
+// Upper bound on the number of released DirectStream blocks each thread holds on to.
+constexpr size_t MaxPooledDirectStreams = 256;
+} // namespace
+
+BlockPool& Client::DirectStream::pool() {
+  thread_local BlockPool pool(sizeof(DirectStream), MaxPooledDirectStreams);
+  return pool;
+}
+
+void* Client::DirectStream::operator new(size_t size) { return pool().allocate(size); }
+
+void Client::DirectStream::operator delete(void* block, size_t size) {
+  pool().release(block, size);
+}
+
 void Client::DirectStream::resetStream(StreamResetReason reason) {
   // This seems in line with other codec implementations, and so the assumption is that this is in
   // line with upstream expectations.
@@ -184,30 +375,73 @@ void Client::DirectStream::resetStream(StreamResetReason reason) {
     return;
   }
   parent_.removeStream(stream_handle_);
-  callbacks_->onError();
+  callbacks_.onError();
+}
+
+void Client::DirectStream::readDisable(bool disable) {
+  if (disable) {
+    ++read_disable_count_;
+    return;
+  }
+
+  ASSERT(read_disable_count_ > 0);
+  if (--read_disable_count_ > 0 || !send_window_pending_) {
+    return;
+  }
+  send_window_pending_ = false;
+  // The request may have been ended or reset while its data was backed up.
+  if (parent_.getStream(stream_handle_)) {
+    callbacks_.onSendWindowAvailable();
+  }
+}
+
+void Client::DirectStream::notifySendWindowAvailable() {
+  // Sending data can end the stream synchronously, e.g. with a local reply.
+  if (!parent_.getStream(stream_handle_)) {
+    return;
+  }
+  if (read_disable_count_ > 0) {
+    send_window_pending_ = true;
+    return;
+  }
+  callbacks_.onSendWindowAvailable();
 }
 
 envoy_status_t Client::startStream(envoy_stream_t new_stream_handle,
-                                   envoy_http_callbacks bridge_callbacks) {
+                                   envoy_http_callbacks bridge_callbacks,
+                                   bool explicit_flow_control,
+                                   absl::optional<MonotonicTime> api_call_time,
+                                   uint32_t buffer_limit) {
   ASSERT(dispatcher_.isThreadSafe());
-  Client::DirectStreamSharedPtr direct_stream{new DirectStream(new_stream_handle, *this)};
-  direct_stream->callbacks_ =
-      std::make_unique<DirectStreamCallbacks>(*direct_stream, bridge_callbacks, *this);
+  Client::DirectStreamPtr direct_stream{
+      new DirectStream(new_stream_handle, bridge_callbacks, *this)};
+  direct_stream->explicit_flow_control_ = explicit_flow_control;
+  direct_stream->buffer_limit_ = buffer_limit;
+  direct_stream->start_time_ = time_source_.monotonicTime();
+  direct_stream->api_call_time_ = api_call_time;
+  if (engine_start_time_.has_value()) {
+    stats_.time_to_first_request_dispatched_.recordValue(
+        std::chrono::duration_cast<std::chrono::milliseconds>(direct_stream->start_time_ -
+                                                              engine_start_time_.value())
+            .count());
+    engine_start_time_.reset();
+  }
 
   // Note: streams created by Envoy Mobile are tagged as is_internally_created. This means that
   // the Http::ConnectionManager _will not_ sanitize headers when creating a stream.
   direct_stream->request_decoder_ =
-      &api_listener_.newStream(*direct_stream->callbacks_, true /* is_internally_created */);
+      &api_listener_.newStream(direct_stream->callbacks_, true /* is_internally_created */);
 
-  streams_.emplace(new_stream_handle, std::move(direct_stream));
-  ENVOY_LOG(debug, "[S{}] start stream", new_stream_handle);
+  streams_.insert(new_stream_handle, std::move(direct_stream));
+  ENVOY_LOG(debug, "[S{}] start stream (explicit_flow_control={}, buffer_limit={})",
+            new_stream_handle, explicit_flow_control, buffer_limit);
 
   return ENVOY_SUCCESS;
 }
 
 envoy_status_t Client::sendHeaders(envoy_stream_t stream, envoy_headers headers, bool end_stream) {
   ASSERT(dispatcher_.isThreadSafe());
-  Client::DirectStreamSharedPtr direct_stream = getStream(stream);
+  Client::DirectStream* direct_stream = getStream(stream);
   // If direct_stream is not found, it means the stream has already closed or been reset
   // and the appropriate callback has been issued to the caller. There's nothing to do here
   // except silently swallow this.
@@ -242,7 +476,7 @@ envoy_status_t Client::sendHeaders(envoy_stream_t stream, envoy_headers headers,
 
 envoy_status_t Client::sendData(envoy_stream_t stream, envoy_data data, bool end_stream) {
   ASSERT(dispatcher_.isThreadSafe());
-  Client::DirectStreamSharedPtr direct_stream = getStream(stream);
+  Client::DirectStream* direct_stream = getStream(stream);
   // If direct_stream is not found, it means the stream has already closed or been reset
   // and the appropriate callback has been issued to the caller. There's nothing to do here
   // except silently swallow this.
@@ -257,7 +491,48 @@ envoy_status_t Client::sendData(envoy_stream_t stream, envoy_data data, bool end
 
     ENVOY_LOG(debug, "[S{}] request data for stream (length={} end_stream={})\n", stream,
               data.length, end_stream);
+    direct_stream->sent_byte_count_ += buf->length();
     direct_stream->request_decoder_->decodeData(*buf, end_stream);
+    if (direct_stream->explicit_flow_control_ && !end_stream) {
+      direct_stream->notifySendWindowAvailable();
+    }
+  }
+
+  return ENVOY_SUCCESS;
+}
+
+envoy_status_t Client::sendDataVector(envoy_stream_t stream, envoy_data_vector data,
+                                      bool end_stream) {
+  ASSERT(dispatcher_.isThreadSafe());
+  Client::DirectStream* direct_stream = getStream(stream);
+  // If direct_stream is not found, it means the stream has already closed or been reset
+  // and the appropriate callback has been issued to the caller. There's nothing to do here
+  // except silently swallow this.
+  // https://github.com/lyft/envoy-mobile/issues/301
+  if (direct_stream) {
+    // As with sendData, the buffer is moved internally in a synchronous fashion. Each segment
+    // becomes its own fragment, so no coalescing copy is made.
+    Buffer::InstancePtr buf = Data::Utility::toInternalData(data);
+
+    ENVOY_LOG(debug, "[S{}] request data for stream (length={} segments={} end_stream={})\n",
+              stream, buf->length(), data.length, end_stream);
+    direct_stream->sent_byte_count_ += buf->length();
+    direct_stream->request_decoder_->decodeData(*buf, end_stream);
+    if (direct_stream->explicit_flow_control_ && !end_stream) {
+      direct_stream->notifySendWindowAvailable();
+    }
+  }
+
+  return ENVOY_SUCCESS;
+}
+
+envoy_status_t Client::readData(envoy_stream_t stream, size_t bytes_to_read) {
+  ASSERT(dispatcher_.isThreadSafe());
+  Client::DirectStream* direct_stream = getStream(stream, GetStreamFilters::AllowForAllStreams);
+  // As with the send functions, a stream that has already closed is silently ignored.
+  if (direct_stream && direct_stream->explicit_flow_control_ && bytes_to_read > 0) {
+    ENVOY_LOG(debug, "[S{}] read window for stream (bytes={})", stream, bytes_to_read);
+    direct_stream->callbacks_.resumeData(bytes_to_read);
   }
 
   return ENVOY_SUCCESS;
@@ -269,7 +544,7 @@ envoy_status_t Client::sendMetadata(envoy_stream_t, envoy_headers) {
 
 envoy_status_t Client::sendTrailers(envoy_stream_t stream, envoy_headers trailers) {
   ASSERT(dispatcher_.isThreadSafe());
-  Client::DirectStreamSharedPtr direct_stream = getStream(stream);
+  Client::DirectStream* direct_stream = getStream(stream);
   // If direct_stream is not found, it means the stream has already closed or been reset
   // and the appropriate callback has been issued to the caller. There's nothing to do here
   // except silently swallow this.
@@ -286,15 +561,51 @@ envoy_status_t Client::sendTrailers(envoy_stream_t stream, envoy_headers trailer
   return ENVOY_SUCCESS;
 }
 
+void Client::applyStreamOperations(const envoy_stream_operation* operations, size_t count,
+                                   absl::optional<MonotonicTime> api_call_time) {
+  ASSERT(dispatcher_.isThreadSafe());
+  for (size_t i = 0; i < count; i++) {
+    const envoy_stream_operation& operation = operations[i];
+    switch (operation.type) {
+    case ENVOY_STREAM_OP_START:
+      startStream(operation.stream, operation.callbacks, false, api_call_time);
+      break;
+    case ENVOY_STREAM_OP_HEADERS:
+      sendHeaders(operation.stream, operation.headers, operation.end_stream);
+      break;
+    case ENVOY_STREAM_OP_DATA:
+      sendData(operation.stream, operation.data, operation.end_stream);
+      break;
+    case ENVOY_STREAM_OP_DATA_VECTOR:
+      sendDataVector(operation.stream, operation.data_vector, operation.end_stream);
+      break;
+    case ENVOY_STREAM_OP_TRAILERS:
+      sendTrailers(operation.stream, operation.headers);
+      break;
+    case ENVOY_STREAM_OP_RESET:
+      cancelStream(operation.stream);
+      break;
+    case ENVOY_STREAM_OP_READ_DATA:
+      readData(operation.stream, operation.bytes_to_read);
+      break;
+    }
+  }
+}
+
 envoy_status_t Client::cancelStream(envoy_stream_t stream) {
   ASSERT(dispatcher_.isThreadSafe());
-  Client::DirectStreamSharedPtr direct_stream = getStream(stream);
+  Client::DirectStream* direct_stream = getStream(stream, GetStreamFilters::AllowForAllStreams);
   if (direct_stream) {
     removeStream(direct_stream->stream_handle_);
 
     // Testing hook.
     synchronizer_.syncPoint("dispatch_on_cancel");
-    direct_stream->callbacks_->onCancel();
+    direct_stream->callbacks_.onCancel();
+
+    // A response that has ended in Envoy has nothing left to reset there.
+    if (direct_stream->remote_end_stream_received_) {
+      return ENVOY_SUCCESS;
+    }
 
     // Since https://github.com/envoyproxy/envoy/pull/13052, the connection manager expects that
     // response code details are set on all possible paths for streams.
@@ -313,10 +624,13 @@ envoy_status_t Client::cancelStream(envoy_stream_t stream) {
 
 const HttpClientStats& Client::stats() const { return stats_; }
 
-Client::DirectStreamSharedPtr Client::getStream(envoy_stream_t stream) {
-  auto direct_stream_pair_it = streams_.find(stream);
-  // Returning will copy the shared_ptr and increase the ref count.
-  return (direct_stream_pair_it != streams_.end()) ? direct_stream_pair_it->second : nullptr;
+Client::DirectStream* Client::getStream(envoy_stream_t stream, GetStreamFilters filters) {
+  Client::DirectStream* direct_stream = streams_.find(stream);
+  if (direct_stream && direct_stream->remote_end_stream_received_ &&
+      filters == GetStreamFilters::AllowOnlyForOpenStreams) {
+    return nullptr;
+  }
+  return direct_stream;
 }
 
 void Client::removeStream(envoy_stream_t stream_handle) {
@@ -324,25 +638,21 @@ void Client::removeStream(envoy_stream_t stream_handle) {
       dispatcher_.isThreadSafe(),
       fmt::format("[S{}] stream removeStream must be performed on the dispatcher_'s thread.",
                   stream_handle));
-  Client::DirectStreamSharedPtr direct_stream = getStream(stream_handle);
+  // The entry should not exist after removeStream, hence why it is synchronously erased from the
+  // streams container.
+  Client::DirectStreamPtr direct_stream = streams_.erase(stream_handle);
   RELEASE_ASSERT(
       direct_stream,
       fmt::format(
           "[S{}] removeStream is a private method that is only called with stream ids that exist",
           stream_handle));
 
-  // The DirectStream should live through synchronous code that already has a reference to it.
-  // Hence why it is scheduled for deferred deletion. If this was all that was needed then it
-  // would be sufficient to return a shared_ptr in getStream. However, deferred deletion is still
-  // required because in Client::resetStream the DirectStream needs to live for as long and
-  // the HCM's ActiveStream lives. Hence its deletion needs to live beyond the synchronous code in
-  // Client::resetStream.
-  auto direct_stream_wrapper = std::make_unique<DirectStreamWrapper>(std::move(direct_stream));
-  dispatcher_.deferredDelete(std::move(direct_stream_wrapper));
-  // However, the entry in the map should not exist after removeStream.
-  // Hence why it is synchronously erased from the streams map.
-  size_t erased = streams_.erase(stream_handle);
-  ASSERT(erased == 1, "removeStream should always remove one entry from the streams map");
+  // The DirectStream should live through synchronous code that already has a pointer to it. Hence
+  // why it is scheduled for deferred deletion. Deferred deletion is also required because in
+  // Client::resetStream the DirectStream needs to live for as long as the HCM's ActiveStream
+  // lives, which Envoy defer deletes first; using post to delete the DirectStream would provide no
+  // ordering guarantee per envoy/source/common/event/libevent.h
+  dispatcher_.deferredDelete(std::move(direct_stream));
   ENVOY_LOG(debug, "[S{}] erased stream from streams container", stream_handle);
 }
 
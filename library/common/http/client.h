@@ -1,18 +1,21 @@
 #pragma once
 
 #include "envoy/buffer/buffer.h"
+#include "envoy/common/time.h"
 #include "envoy/event/deferred_deletable.h"
 #include "envoy/http/api_listener.h"
 #include "envoy/http/codec.h"
 #include "envoy/http/header_map.h"
 #include "envoy/stats/stats_macros.h"
 
+#include "common/buffer/buffer_impl.h"
 #include "common/common/logger.h"
 #include "common/http/codec_helper.h"
 
-#include "absl/container/flat_hash_map.h"
 #include "absl/types/optional.h"
+#include "library/common/common/block_pool.h"
 #include "library/common/event/provisional_dispatcher.h"
+#include "library/common/http/stream_slot_map.h"
 #include "library/common/network/synthetic_address_impl.h"
 #include "library/common/types/c_types.h"
 
@@ -22,16 +25,24 @@ namespace Http {
 /**
  * All http client stats. @see stats_macros.h
  */
-#define ALL_HTTP_CLIENT_STATS(COUNTER)                                                             \
+#define ALL_HTTP_CLIENT_STATS(COUNTER, HISTOGRAM)                                                  \
   COUNTER(stream_success)                                                                          \
   COUNTER(stream_failure)                                                                          \
-  COUNTER(stream_cancel)
+  COUNTER(stream_cancel)                                                                           \
+  HISTOGRAM(stream_dispatch_latency, Microseconds)                                                 \
+  HISTOGRAM(stream_headers_latency, Microseconds)                                                  \
+  HISTOGRAM(stream_first_data_latency, Microseconds)                                               \
+  HISTOGRAM(stream_last_data_latency, Microseconds)                                                \
+  HISTOGRAM(stream_total_latency, Microseconds)                                                    \
+  HISTOGRAM(time_to_first_request_dispatched, Milliseconds)
 
 /**
  * Struct definition for client stats. @see stats_macros.h
+ * The latency histograms measure from the platform's call to start a stream to the point at which
+ * the stream reached each phase, @see envoy_stream_timings.
  */
 struct HttpClientStats {
-  ALL_HTTP_CLIENT_STATS(GENERATE_COUNTER_STRUCT)
+  ALL_HTTP_CLIENT_STATS(GENERATE_COUNTER_STRUCT, GENERATE_HISTOGRAM_STRUCT)
 };
 
 /**
@@ -39,22 +50,59 @@ struct HttpClientStats {
  */
 class Client : public Logger::Loggable<Logger::Id::http> {
 public:
+  // Default for the response data buffered on a stream with explicit flow control before Envoy is
+  // asked to stop reading, @see startStream.
+  static constexpr uint32_t DefaultBufferLimit = 65000;
+
+  // stream_stride is the distance between consecutive handles of the streams this client runs,
+  // @see StreamSlotMap.
   Client(ApiListener& api_listener, Event::ProvisionalDispatcher& dispatcher, Stats::Scope& scope,
-         std::atomic<envoy_network_t>& preferred_network)
+         std::atomic<envoy_network_t>& preferred_network, TimeSource& time_source,
+         size_t stream_stride = 1)
       : api_listener_(api_listener), dispatcher_(dispatcher),
-        stats_(HttpClientStats{ALL_HTTP_CLIENT_STATS(POOL_COUNTER_PREFIX(scope, "http.client."))}),
-        preferred_network_(preferred_network),
+        stats_(HttpClientStats{
+            ALL_HTTP_CLIENT_STATS(POOL_COUNTER_PREFIX(scope, "http.client."),
+                                  POOL_HISTOGRAM_PREFIX(scope, "http.client."))}),
+        streams_(64, stream_stride), preferred_network_(preferred_network),
+        time_source_(time_source),
         address_(std::make_shared<Network::Address::SyntheticAddressImpl>()) {}
 
+  /**
+   * Record time_to_first_request_dispatched, measured from start_time to the first subsequent call
+   * to startStream. Only the first stream after this call is measured.
+   * @param start_time, when the engine was asked to run.
+   */
+  void setEngineStartTime(MonotonicTime start_time) { engine_start_time_ = start_time; }
+
   /**
    * Attempts to open a new stream to the remote. Note that this function is asynchronous and
    * opening a stream may fail. The returned handle is immediately valid for use with this API, but
    * there is no guarantee it will ever functionally represent an open stream.
    * @param stream, the stream to start.
    * @param bridge_callbacks, wrapper for callbacks for events on this stream.
+   * @param explicit_flow_control, whether response data is held back until the platform asks for
+   * it with readData, rather than being delivered as soon as it arrives.
+   * @param api_call_time, when the platform asked for the stream to be started, if known. Stream
+   * latency is measured from this point, or from the call to startStream otherwise.
+   * @param buffer_limit, the stream's buffer limit in bytes, which also bounds buffering in Envoy's
+   * filters. With explicit flow control, Envoy stops reading the response once more than this is
+   * held for the platform, and resumes once no more than half of it is.
    * @return envoy_stream_t handle to the stream being created.
    */
-  envoy_status_t startStream(envoy_stream_t stream, envoy_http_callbacks bridge_callbacks);
+  envoy_status_t startStream(envoy_stream_t stream, envoy_http_callbacks bridge_callbacks,
+                             bool explicit_flow_control = false,
+                             absl::optional<MonotonicTime> api_call_time = absl::nullopt,
+                             uint32_t buffer_limit = DefaultBufferLimit);
+
+  /**
+   * Grant a read window on a stream started with explicit flow control. Up to bytes_to_read bytes
+   * of response data are delivered in a single data callback, as soon as any are available. The
+   * window is not cumulative: a later call replaces a window that has not been used yet.
+   * @param stream, the stream to read from.
+   * @param bytes_to_read, the maximum number of bytes to deliver.
+   * @return envoy_status_t, the resulting status of the operation.
+   */
+  envoy_status_t readData(envoy_stream_t stream, size_t bytes_to_read);
 
   /**
    * Send headers over an open HTTP stream. This method can be invoked once and needs to be called
@@ -75,6 +123,16 @@ public:
    */
   envoy_status_t sendData(envoy_stream_t stream, envoy_data data, bool end_stream);
 
+  /**
+   * Send scatter-gather data over an open HTTP stream. This method can be invoked multiple times.
+   * Segments are passed to Envoy without being coalesced.
+   * @param stream, the stream to send data over.
+   * @param data, the data to send.
+   * @param end_stream, indicates whether to close the stream locally after sending this frame.
+   * @return envoy_status_t, the resulting status of the operation.
+   */
+  envoy_status_t sendDataVector(envoy_stream_t stream, envoy_data_vector data, bool end_stream);
+
   /**
    * Send metadata over an HTTP stream. This method can be invoked multiple times.
    * @param stream, the stream to send metadata over.
@@ -100,6 +158,16 @@ public:
    */
   envoy_status_t cancelStream(envoy_stream_t stream);
 
+  /**
+   * Apply a batch of stream operations in order, as if each had been issued through the
+   * corresponding single-operation method.
+   * @param operations, the operations to apply.
+   * @param count, the number of operations.
+   * @param api_call_time, when the platform submitted the operations, if known.
+   */
+  void applyStreamOperations(const envoy_stream_operation* operations, size_t count,
+                             absl::optional<MonotonicTime> api_call_time = absl::nullopt);
+
   const HttpClientStats& stats() const;
 
   // Used to fill response code details for streams that are cancelled via cancelStream.
@@ -124,12 +192,18 @@ private:
   public:
     DirectStreamCallbacks(DirectStream& direct_stream, envoy_http_callbacks bridge_callbacks,
                           Client& http_client);
+    ~DirectStreamCallbacks();
 
     void closeStream();
     void onComplete();
     void onCancel();
     void onError();
 
+    // Delivers buffered response data up to bytes_to_send, followed by trailers and completion
+    // once everything has been delivered. Only used with explicit flow control.
+    void resumeData(size_t bytes_to_send);
+    void onSendWindowAvailable();
+
     // ResponseEncoder
     void encodeHeaders(const ResponseHeaderMap& headers, bool end_stream) override;
     void encodeData(Buffer::Instance& data, bool end_stream) override;
@@ -144,28 +218,51 @@ private:
     void encodeMetadata(const MetadataMapVector&) override { NOT_IMPLEMENTED_GCOVR_EXCL_LINE; }
 
   private:
+    void sendDataToBridge(Buffer::Instance& data, bool end_stream);
+    void bufferData(Buffer::Instance& data, bool end_stream);
+    void sendBufferedData();
+    void updateWatermarks();
+    // Records the stream's latency breakdown and reports it to the platform. Called on the way to
+    // each terminal callback.
+    void recordLatency();
+    // What the stream observed, as reported with each terminal callback.
+    envoy_stream_intel streamIntel() const;
+
     DirectStream& direct_stream_;
     const envoy_http_callbacks bridge_callbacks_;
     Client& http_client_;
     absl::optional<envoy_error_code_t> error_code_;
     absl::optional<envoy_data> error_message_;
-    absl::optional<int32_t> error_attempt_count_;
+    // Reported by the router on the response headers.
+    absl::optional<int32_t> attempt_count_;
+    absl::optional<int64_t> upstream_service_time_ms_;
     bool success_{};
-  };
 
-  using DirectStreamCallbacksPtr = std::unique_ptr<DirectStreamCallbacks>;
+    // Response state held for the platform under explicit flow control.
+    Buffer::OwnedImpl response_data_;
+    absl::optional<envoy_headers> response_trailers_;
+    size_t bytes_to_send_{};
+    bool above_high_watermark_{};
+  };
 
   /**
    * Contains state about an HTTP stream; both in the outgoing direction via an underlying
    * AsyncClient::Stream and in the incoming direction via DirectStreamCallbacks.
+   * DirectStreams are allocated from a per-thread BlockPool. Each engine runs all of its streams
+   * on a single network thread, so in practice every engine recycles its own stream blocks.
    */
   class DirectStream : public Stream,
                        public StreamCallbackHelper,
+                       public Event::DeferredDeletable,
                        public Logger::Loggable<Logger::Id::http> {
   public:
-    DirectStream(envoy_stream_t stream_handle, Client& http_client);
+    DirectStream(envoy_stream_t stream_handle, envoy_http_callbacks bridge_callbacks,
+                 Client& http_client);
     ~DirectStream();
 
+    static void* operator new(size_t size);
+    static void operator delete(void* block, size_t size);
+
     // Stream
     void addCallbacks(StreamCallbacks& callbacks) override { addCallbacksHelper(callbacks); }
     void removeCallbacks(StreamCallbacks& callbacks) override { removeCallbacksHelper(callbacks); }
@@ -174,9 +271,9 @@ private:
       return parent_.address_;
     }
     absl::string_view responseDetails() override { return response_details_; }
-    // TODO: https://github.com/lyft/envoy-mobile/issues/825
-    void readDisable(bool /*disable*/) override {}
-    uint32_t bufferLimit() override { return 65000; }
+    // Envoy read-disables the stream while its request data is backed up upstream.
+    void readDisable(bool disable) override;
+    uint32_t bufferLimit() override { return buffer_limit_; }
     // Not applicable
     void setFlushTimeout(std::chrono::milliseconds) override {}
 
@@ -184,43 +281,67 @@ private:
       response_details_ = response_details;
     }
 
+    // Tells the platform it may send more request data, as soon as the stream is not
+    // read-disabled. Only used with explicit flow control.
+    void notifySendWindowAvailable();
+
     const envoy_stream_t stream_handle_;
 
     // Used to issue outgoing HTTP stream operations.
     RequestDecoder* request_decoder_;
-    // Used to receive incoming HTTP stream operations.
-    DirectStreamCallbacksPtr callbacks_;
+    // Whether response data waits for the platform to grant a read window.
+    bool explicit_flow_control_{};
+    // Set before the stream is handed to Envoy, which reads it once when the stream is created.
+    uint32_t buffer_limit_{DefaultBufferLimit};
+    // Set when Envoy has finished the response while some of it is still held for the platform.
+    // Envoy is done with the stream at that point, so only reads and cancellation apply to it.
+    bool remote_end_stream_received_{};
+    // Outstanding readDisable(true) calls.
+    uint32_t read_disable_count_{};
+    // Whether the platform is waiting for the stream to be read-enabled before sending more data.
+    bool send_window_pending_{};
+    // When the platform asked for the stream, if known, and when Envoy's thread started it.
+    absl::optional<MonotonicTime> api_call_time_;
+    MonotonicTime start_time_;
+    absl::optional<MonotonicTime> response_headers_time_;
+    absl::optional<MonotonicTime> first_response_data_time_;
+    absl::optional<MonotonicTime> last_response_data_time_;
+    // Body bytes passed to Envoy, and produced by Envoy before any flow control buffering.
+    uint64_t sent_byte_count_{};
+    uint64_t received_byte_count_{};
     Client& parent_;
+    // Used to receive incoming HTTP stream operations.
+    DirectStreamCallbacks callbacks_;
     // Response details used by the connection manager.
     absl::string_view response_details_;
-  };
-
-  using DirectStreamSharedPtr = std::shared_ptr<DirectStream>;
-
-  // Used to deferredDelete the ref count of the DirectStream owned by streams_ while still
-  // maintaining a container of DirectStreamSharedPtr. Using deferredDelete is important due to the
-  // necessary ordering of ActiveStream deletion w.r.t DirectStream deletion; the former needs to be
-  // destroyed first. Using post to defer delete the DirectStream provides no ordering guarantee per
-  // envoy/source/common/event/libevent.h Maintaining a container of DirectStreamSharedPtr is
-  // important because Client::resetStream is initiated by a platform thread.
-  struct DirectStreamWrapper : public Event::DeferredDeletable {
-    DirectStreamWrapper(DirectStreamSharedPtr stream) : stream_(stream) {}
 
   private:
-    const DirectStreamSharedPtr stream_;
+    static BlockPool& pool();
   };
 
-  using DirectStreamWrapperPtr = std::unique_ptr<DirectStreamWrapper>;
+  using DirectStreamPtr = std::unique_ptr<DirectStream>;
+
+  enum class GetStreamFilters {
+    // Only streams that Envoy is still processing.
+    AllowOnlyForOpenStreams,
+    // Also streams whose response has ended in Envoy but is still held for the platform.
+    AllowForAllStreams,
+  };
 
-  DirectStreamSharedPtr getStream(envoy_stream_t stream_handle);
+  // Returns a pointer that stays valid for the rest of the current dispatcher iteration, even if
+  // the stream is removed in the meantime.
+  DirectStream* getStream(envoy_stream_t stream_handle,
+                          GetStreamFilters filters = GetStreamFilters::AllowOnlyForOpenStreams);
   void removeStream(envoy_stream_t stream_handle);
   void setDestinationCluster(RequestHeaderMap& headers);
 
   ApiListener& api_listener_;
   Event::ProvisionalDispatcher& dispatcher_;
   HttpClientStats stats_;
-  absl::flat_hash_map<envoy_stream_t, DirectStreamSharedPtr> streams_;
+  StreamSlotMap<DirectStream> streams_;
   std::atomic<envoy_network_t>& preferred_network_;
+  TimeSource& time_source_;
+  absl::optional<MonotonicTime> engine_start_time_;
   // Shared synthetic address across DirectStreams.
   Network::Address::InstanceConstSharedPtr address_;
   Thread::ThreadSynchronizer synchronizer_;
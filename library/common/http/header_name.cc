@@ -0,0 +1,165 @@
+#include "library/common/http/header_name.h"
+
+#include <array>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace Envoy {
+namespace Http {
+namespace Utility {
+
+namespace {
+
+// Separators excluded from the printable ASCII range (0x21-0x7e) by the RFC 7230 token grammar.
+// ':' is deliberately absent since pseudo-header names start with it.
+constexpr char Separators[] = {'"', '(', ')', ',', '/', ';', '<', '=',
+                               '>', '?', '@', '[', '\\', ']', '{', '}'};
+
+constexpr std::array<bool, 256> buildValidTable() {
+  std::array<bool, 256> table{};
+  for (int c = 0x21; c <= 0x7e; c++) {
+    table[c] = true;
+  }
+  for (char c : Separators) {
+    table[static_cast<uint8_t>(c)] = false;
+  }
+  return table;
+}
+
+constexpr std::array<bool, 256> ValidTable = buildValidTable();
+
+bool isUpper(uint8_t c) { return c >= 'A' && c <= 'Z'; }
+
+#if defined(__SSE2__)
+
+constexpr size_t VectorSize = 16;
+
+// Returns a mask of the lanes holding upper-case letters. Bytes >= 0x80 compare as negative and so
+// fall outside the range.
+__m128i upperMask(__m128i v) {
+  return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('A' - 1)),
+                       _mm_cmplt_epi8(v, _mm_set1_epi8('Z' + 1)));
+}
+
+// Returns a mask of the lanes holding characters that are not valid in a header name.
+__m128i invalidMask(__m128i v) {
+  __m128i invalid = _mm_or_si128(_mm_cmplt_epi8(v, _mm_set1_epi8(0x21)),
+                                 _mm_cmpgt_epi8(v, _mm_set1_epi8(0x7e)));
+  for (char c : Separators) {
+    invalid = _mm_or_si128(invalid, _mm_cmpeq_epi8(v, _mm_set1_epi8(c)));
+  }
+  return invalid;
+}
+
+bool any(__m128i mask) { return _mm_movemask_epi8(mask) != 0; }
+
+__m128i load(const char* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+
+void store(char* p, __m128i v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+
+__m128i toLower(__m128i v, __m128i upper) {
+  return _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+}
+
+using Vector = __m128i;
+Vector zero() { return _mm_setzero_si128(); }
+Vector combine(Vector a, Vector b) { return _mm_or_si128(a, b); }
+
+#elif defined(__aarch64__)
+
+constexpr size_t VectorSize = 16;
+
+uint8x16_t upperMask(uint8x16_t v) {
+  return vandq_u8(vcgeq_u8(v, vdupq_n_u8('A')), vcleq_u8(v, vdupq_n_u8('Z')));
+}
+
+uint8x16_t invalidMask(uint8x16_t v) {
+  uint8x16_t invalid = vorrq_u8(vcltq_u8(v, vdupq_n_u8(0x21)), vcgtq_u8(v, vdupq_n_u8(0x7e)));
+  for (char c : Separators) {
+    invalid = vorrq_u8(invalid, vceqq_u8(v, vdupq_n_u8(static_cast<uint8_t>(c))));
+  }
+  return invalid;
+}
+
+bool any(uint8x16_t mask) { return vmaxvq_u8(mask) != 0; }
+
+uint8x16_t load(const char* p) { return vld1q_u8(reinterpret_cast<const uint8_t*>(p)); }
+
+void store(char* p, uint8x16_t v) { vst1q_u8(reinterpret_cast<uint8_t*>(p), v); }
+
+uint8x16_t toLower(uint8x16_t v, uint8x16_t upper) {
+  return vorrq_u8(v, vandq_u8(upper, vdupq_n_u8(0x20)));
+}
+
+using Vector = uint8x16_t;
+Vector zero() { return vdupq_n_u8(0); }
+Vector combine(Vector a, Vector b) { return vorrq_u8(a, b); }
+
+#endif
+
+} // namespace
+
+HeaderNameCase scanHeaderName(absl::string_view name) {
+  const char* data = name.data();
+  const size_t size = name.size();
+  size_t i = 0;
+  bool upper = false;
+  bool invalid = false;
+
+#if defined(__SSE2__) || defined(__aarch64__)
+  // Masks are accumulated across the whole name and inspected once at the end.
+  Vector upper_acc = zero();
+  Vector invalid_acc = zero();
+  for (; i + VectorSize <= size; i += VectorSize) {
+    const Vector v = load(data + i);
+    upper_acc = combine(upper_acc, upperMask(v));
+    invalid_acc = combine(invalid_acc, invalidMask(v));
+  }
+  upper = any(upper_acc);
+  invalid = any(invalid_acc);
+#endif
+
+  for (; i < size; i++) {
+    const uint8_t c = static_cast<uint8_t>(data[i]);
+    upper |= isUpper(c);
+    invalid |= !ValidTable[c];
+  }
+
+  if (invalid) {
+    return HeaderNameCase::Invalid;
+  }
+  return upper ? HeaderNameCase::Mixed : HeaderNameCase::Lower;
+}
+
+bool lowerCaseHeaderName(absl::string_view name, char* out) {
+  const char* data = name.data();
+  const size_t size = name.size();
+  size_t i = 0;
+  bool invalid = false;
+
+#if defined(__SSE2__) || defined(__aarch64__)
+  Vector invalid_acc = zero();
+  for (; i + VectorSize <= size; i += VectorSize) {
+    const Vector v = load(data + i);
+    invalid_acc = combine(invalid_acc, invalidMask(v));
+    store(out + i, toLower(v, upperMask(v)));
+  }
+  invalid = any(invalid_acc);
+#endif
+
+  for (; i < size; i++) {
+    const uint8_t c = static_cast<uint8_t>(data[i]);
+    invalid |= !ValidTable[c];
+    out[i] = static_cast<char>(isUpper(c) ? c | 0x20 : c);
+  }
+  return !invalid;
+}
+
+} // namespace Utility
+} // namespace Http
+} // namespace Envoy
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "absl/strings/string_view.h"
+
+namespace Envoy {
+namespace Http {
+namespace Utility {
+
+/**
+ * Classification of a header name produced by scanHeaderName.
+ */
+enum class HeaderNameCase {
+  // Every character is a valid token character and none are upper-case.
+  Lower,
+  // Every character is a valid token character and at least one is upper-case.
+  Mixed,
+  // At least one character is not a valid token character.
+  Invalid,
+};
+
+/**
+ * Validates a header name and detects whether it needs lower-casing, in a single pass.
+ * Valid characters are the RFC 7230 token characters plus ':', which pseudo-headers start with.
+ * Uses SSE2 or NEON where available, with a scalar fallback.
+ * @param name, the header name to scan.
+ * @return HeaderNameCase, the classification of name.
+ */
+HeaderNameCase scanHeaderName(absl::string_view name);
+
+/**
+ * Writes the lower-cased form of a header name while validating it, in a single pass.
+ * Uses SSE2 or NEON where available, with a scalar fallback.
+ * @param name, the header name to transform.
+ * @param out, destination for name.size() lower-cased bytes. May alias name.data().
+ * @return bool, whether every character of name is valid per scanHeaderName.
+ */
+bool lowerCaseHeaderName(absl::string_view name, char* out);
+
+} // namespace Utility
+} // namespace Http
+} // namespace Envoy
@@ -1,20 +1,86 @@
 #include "library/common/http/header_utility.h"
 
+#include "common/common/assert.h"
 #include "common/http/header_map_impl.h"
 
-#include "library/common/data/utility.h"
+#include "absl/container/inlined_vector.h"
+#include "library/common/http/header_name.h"
+#include "library/common/http/interned_headers.h"
 
 namespace Envoy {
 namespace Http {
 namespace Utility {
 
-RequestHeaderMapPtr toRequestHeaders(envoy_headers headers) {
-  RequestHeaderMapPtr transformed_headers = RequestHeaderMapImpl::create();
+namespace {
+
+absl::string_view toStringView(envoy_data data) {
+  return {reinterpret_cast<const char*>(data.bytes), data.length};
+}
+
+// Adds every entry in headers to header_map, copying each value exactly once. Interned keys are
+// referenced rather than copied, and other keys are validated and copied once straight into their
+// HeaderString, being lower-cased on the way only when needed.
+void addBridgeHeaders(envoy_headers headers, HeaderMap& header_map) {
+  const InternedHeaderValues& interned_headers = InternedHeaders::get();
   for (envoy_map_size_t i = 0; i < headers.length; i++) {
-    transformed_headers->addCopy(
-        LowerCaseString(Data::Utility::copyToString(headers.entries[i].key)),
-        Data::Utility::copyToString(headers.entries[i].value));
+    const envoy_map_entry& entry = headers.entries[i];
+    const absl::string_view key_view = toStringView(entry.key);
+    const absl::string_view value_view = toStringView(entry.value);
+
+    // Keys handed out by the interned table are recognized without hashing; platforms that copy
+    // header names (e.g. from JVM strings) still hit the table by name.
+    const LowerCaseString* interned_key = interned_headers.lookup(entry.key);
+    if (interned_key == nullptr) {
+      interned_key = interned_headers.findName(key_view);
+    }
+    if (interned_key != nullptr) {
+      header_map.addReferenceKey(*interned_key, value_view);
+      continue;
+    }
+
+    HeaderString key;
+    switch (scanHeaderName(key_view)) {
+    case HeaderNameCase::Lower:
+      key.setCopy(key_view);
+      break;
+    case HeaderNameCase::Mixed: {
+      absl::InlinedVector<char, 128> buffer(key_view.size());
+      lowerCaseHeaderName(key_view, buffer.data());
+      const absl::string_view lowered(buffer.data(), buffer.size());
+      interned_key = interned_headers.findName(lowered);
+      if (interned_key != nullptr) {
+        header_map.addReferenceKey(*interned_key, value_view);
+        continue;
+      }
+      key.setCopy(lowered);
+      break;
+    }
+    case HeaderNameCase::Invalid:
+      // Defer to LowerCaseString so that invalid names get exactly its handling, including its
+      // debug assertion.
+      key.setCopy(LowerCaseString(std::string(key_view)).get());
+      break;
+    }
+    HeaderString value;
+    value.setCopy(value_view);
+    header_map.addViaMove(std::move(key), std::move(value));
   }
+}
+
+// Copies str into the packed block at cursor and advances the cursor. The returned envoy_data does
+// not own its bytes; they are freed along with the block.
+envoy_data packBridgeData(absl::string_view str, uint8_t*& cursor) {
+  memcpy(cursor, str.data(), str.length()); // NOLINT(safe-memcpy)
+  envoy_data data = {str.length(), cursor, envoy_noop_release, nullptr};
+  cursor += str.length();
+  return data;
+}
+
+} // namespace
+
+RequestHeaderMapPtr toRequestHeaders(envoy_headers headers) {
+  RequestHeaderMapPtr transformed_headers = RequestHeaderMapImpl::create();
+  addBridgeHeaders(headers, *transformed_headers);
   // The C envoy_headers struct can be released now because the headers have been copied.
   release_envoy_headers(headers);
   return transformed_headers;
@@ -22,32 +88,39 @@ RequestHeaderMapPtr toRequestHeaders(envoy_headers headers) {
 
 RequestTrailerMapPtr toRequestTrailers(envoy_headers trailers) {
   RequestTrailerMapPtr transformed_trailers = RequestTrailerMapImpl::create();
-  for (envoy_map_size_t i = 0; i < trailers.length; i++) {
-    transformed_trailers->addCopy(
-        LowerCaseString(Data::Utility::copyToString(trailers.entries[i].key)),
-        Data::Utility::copyToString(trailers.entries[i].value));
-  }
+  addBridgeHeaders(trailers, *transformed_trailers);
   // The C envoy_headers struct can be released now because the headers have been copied.
   release_envoy_headers(trailers);
   return transformed_trailers;
 }
 
 envoy_headers toBridgeHeaders(const HeaderMap& header_map) {
-  envoy_map_entry* headers =
-      static_cast<envoy_map_entry*>(safe_malloc(sizeof(envoy_map_entry) * header_map.size()));
+  // The entry array and all key/value bytes are packed into a single allocation, with the entry
+  // array at its head. Keys and values carry no-op release functions, so the free() of the entry
+  // array in release_envoy_headers releases the whole block. Interned keys point at the interned
+  // header table instead, so the block may end up slightly larger than needed.
+  const size_t entries_size = sizeof(envoy_map_entry) * header_map.size();
+  uint8_t* block = static_cast<uint8_t*>(safe_malloc(entries_size + header_map.byteSize()));
+  uint8_t* cursor = block + entries_size;
+
   envoy_headers transformed_headers;
   transformed_headers.length = 0;
-  transformed_headers.entries = headers;
+  transformed_headers.entries = reinterpret_cast<envoy_map_entry*>(block);
 
-  header_map.iterate([&transformed_headers](const HeaderEntry& header) -> HeaderMap::Iterate {
-    envoy_data key = Data::Utility::copyToBridgeData(header.key().getStringView());
-    envoy_data value = Data::Utility::copyToBridgeData(header.value().getStringView());
+  const InternedHeaderValues& interned_headers = InternedHeaders::get();
+  header_map.iterate([&transformed_headers, &cursor,
+                      &interned_headers](const HeaderEntry& header) -> HeaderMap::Iterate {
+    const envoy_data* interned_key = interned_headers.find(header.key().getStringView());
+    envoy_data key =
+        interned_key ? *interned_key : packBridgeData(header.key().getStringView(), cursor);
+    envoy_data value = packBridgeData(header.value().getStringView(), cursor);
 
     transformed_headers.entries[transformed_headers.length] = {key, value};
     transformed_headers.length++;
 
     return HeaderMap::Iterate::Continue;
   });
+  ASSERT(cursor <= block + entries_size + header_map.byteSize());
   return transformed_headers;
 }
 
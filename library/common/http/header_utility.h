@@ -11,7 +11,8 @@ namespace Utility {
 
 /**
  * Transform envoy_headers to RequestHeaderMap.
- * This function copies the content.
+ * Each value is copied once directly into the header map. Interned header names are referenced
+ * rather than copied, and other names are lower-cased as they are copied.
  * @param headers, the envoy_headers to transform. headers is free'd. Use after function return is
  * unsafe.
  * @return RequestHeaderMapPtr, the RequestHeaderMap 1:1 transformation of the headers param.
@@ -19,8 +20,8 @@ namespace Utility {
 RequestHeaderMapPtr toRequestHeaders(envoy_headers headers);
 
 /**
- * Transform envoy_headers to RequestHeaderMap.
- * This function copies the content.
+ * Transform envoy_headers to RequestTrailerMap.
+ * Copies the content in the same manner as toRequestHeaders.
  * @param trailers, the envoy_headers (trailers) to transform. headers is free'd. Use after function
  * return is unsafe.
  * @return RequestTrailerMapPtr, the RequestTrailerMap 1:1 transformation of the headers param.
@@ -29,8 +30,10 @@ RequestTrailerMapPtr toRequestTrailers(envoy_headers trailers);
 
 /**
  * Transform envoy_headers to HeaderMap.
- * This function copies the content.
- * Caller owns the allocated bytes for the return value, and needs to free after use.
+ * This function copies the content into a single allocation holding both the entry array and all
+ * key/value bytes. Individual keys and values have no-op release functions.
+ * Caller owns the allocated bytes for the return value, and needs to release them with
+ * release_envoy_headers after use.
  * @param headers, the HeaderMap to transform.
  * @return envoy_headers, the HeaderMap 1:1 transformation of the headers param.
  */
@@ -0,0 +1,109 @@
+#include "library/common/http/interned_headers.h"
+
+#include <cstdint>
+
+namespace Envoy {
+namespace Http {
+
+namespace {
+
+// Header names commonly seen on mobile request and response paths. Entries must be lower-case.
+const char* const InternedHeaderNames[] = {
+    ":authority",
+    ":method",
+    ":path",
+    ":scheme",
+    ":status",
+    "accept",
+    "accept-encoding",
+    "accept-language",
+    "accept-ranges",
+    "access-control-allow-origin",
+    "age",
+    "alt-svc",
+    "authorization",
+    "cache-control",
+    "connection",
+    "content-disposition",
+    "content-encoding",
+    "content-language",
+    "content-length",
+    "content-range",
+    "content-type",
+    "cookie",
+    "date",
+    "etag",
+    "expires",
+    "grpc-encoding",
+    "grpc-message",
+    "grpc-status",
+    "if-modified-since",
+    "if-none-match",
+    "last-modified",
+    "link",
+    "location",
+    "origin",
+    "range",
+    "referer",
+    "retry-after",
+    "server",
+    "set-cookie",
+    "strict-transport-security",
+    "te",
+    "transfer-encoding",
+    "user-agent",
+    "vary",
+    "via",
+    "x-content-type-options",
+    "x-envoy-attempt-count",
+    "x-envoy-mobile-cluster",
+    "x-envoy-mobile-upstream-protocol",
+    "x-envoy-upstream-service-time",
+    "x-forwarded-proto",
+    "x-frame-options",
+    "x-request-id",
+    "x-xss-protection",
+};
+
+} // namespace
+
+InternedHeaderValues::InternedHeaderValues() {
+  entries_.reserve(sizeof(InternedHeaderNames) / sizeof(InternedHeaderNames[0]));
+  for (const char* name : InternedHeaderNames) {
+    entries_.emplace_back(name);
+  }
+  // Point each envoy_data at its entry only once the vector is fully populated.
+  for (Entry& entry : entries_) {
+    const std::string& name = entry.name_.get();
+    entry.data_ = {name.size(), reinterpret_cast<const uint8_t*>(name.data()), envoy_noop_release,
+                   &entry};
+    index_.emplace(name, &entry);
+  }
+}
+
+const envoy_data* InternedHeaderValues::find(absl::string_view name) const {
+  auto it = index_.find(name);
+  return it != index_.end() ? &it->second->data_ : nullptr;
+}
+
+const LowerCaseString* InternedHeaderValues::findName(absl::string_view name) const {
+  auto it = index_.find(name);
+  return it != index_.end() ? &it->second->name_ : nullptr;
+}
+
+const LowerCaseString* InternedHeaderValues::lookup(const envoy_data& data) const {
+  if (data.release != envoy_noop_release) {
+    return nullptr;
+  }
+  // The context comes from the platform, so it is only trusted if it addresses an entry exactly.
+  const uintptr_t context = reinterpret_cast<uintptr_t>(data.context);
+  const uintptr_t begin = reinterpret_cast<uintptr_t>(entries_.data());
+  if (context < begin || context >= begin + entries_.size() * sizeof(Entry) ||
+      (context - begin) % sizeof(Entry) != 0) {
+    return nullptr;
+  }
+  return &static_cast<const Entry*>(data.context)->name_;
+}
+
+} // namespace Http
+} // namespace Envoy
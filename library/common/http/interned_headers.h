@@ -0,0 +1,62 @@
+#pragma once
+
+#include <vector>
+
+#include "envoy/http/header_map.h"
+
+#include "common/singleton/const_singleton.h"
+
+#include "absl/container/flat_hash_map.h"
+#include "library/common/types/c_types.h"
+
+namespace Envoy {
+namespace Http {
+
+/**
+ * Process-wide table of commonly used header names, analogous to the HPACK static table.
+ * Interned names are handed across the bridge as envoy_data pointing at immutable storage with a
+ * no-op release function, so converting them neither allocates nor copies.
+ */
+class InternedHeaderValues {
+public:
+  InternedHeaderValues();
+
+  /**
+   * Finds the interned representation of a header name.
+   * @param name, the header name to look up. Matching is exact (case-sensitive).
+   * @return const envoy_data*, the interned envoy_data for the name, or nullptr if not interned.
+   */
+  const envoy_data* find(absl::string_view name) const;
+
+  /**
+   * Finds the interned header name equal to name.
+   * @param name, the header name to look up. Matching is exact (case-sensitive).
+   * @return const LowerCaseString*, the interned name, or nullptr if not interned.
+   */
+  const LowerCaseString* findName(absl::string_view name) const;
+
+  /**
+   * Recovers the interned header name backing an envoy_data. This is a constant-time check of the
+   * envoy_data's release function and context; the bytes are not inspected.
+   * @param data, an envoy_data that may have been obtained from find().
+   * @return const LowerCaseString*, the interned name, or nullptr if data is not interned.
+   */
+  const LowerCaseString* lookup(const envoy_data& data) const;
+
+private:
+  struct Entry {
+    Entry(absl::string_view name) : name_(std::string(name)) {}
+
+    const LowerCaseString name_;
+    envoy_data data_{};
+  };
+
+  // Never resized after construction, so entries (and the bytes they point to) remain stable.
+  std::vector<Entry> entries_;
+  absl::flat_hash_map<absl::string_view, const Entry*> index_;
+};
+
+using InternedHeaders = ConstSingleton<InternedHeaderValues>;
+
+} // namespace Http
+} // namespace Envoy
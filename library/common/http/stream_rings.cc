@@ -0,0 +1,189 @@
+#include "library/common/http/stream_rings.h"
+
+#include "common/common/lock_guard.h"
+
+namespace Envoy {
+namespace Http {
+
+StreamRings::StreamRings(Event::ProvisionalDispatcher& dispatcher, ApplyCb apply,
+                         size_t submission_capacity, size_t completion_capacity)
+    : dispatcher_(dispatcher), apply_(std::move(apply)), submissions_(submission_capacity),
+      completions_(completion_capacity) {}
+
+size_t StreamRings::submit(const envoy_stream_operation* operations, size_t count) {
+  size_t accepted = 0;
+  while (accepted < count) {
+    envoy_stream_operation operation = operations[accepted];
+    if (!submissions_.push(operation)) {
+      break;
+    }
+    accepted++;
+  }
+
+  // Operations pushed after a drain has started are picked up by it or by a subsequent drain,
+  // since the drain clears drain_scheduled_ before popping.
+  if (accepted > 0 && !drain_scheduled_.exchange(true)) {
+    dispatcher_.post([this]() -> void { drainSubmissions(); });
+  }
+  return accepted;
+}
+
+void StreamRings::drainSubmissions() {
+  drain_scheduled_.store(false);
+
+  // Bound the work done per drain so that a steady stream of submissions cannot starve other
+  // events.
+  size_t budget = submissions_.capacity();
+  envoy_stream_operation operation;
+  while (budget > 0 && submissions_.pop(operation)) {
+    budget--;
+    apply_(&operation, 1);
+  }
+
+  if (budget == 0 && !drain_scheduled_.exchange(true)) {
+    dispatcher_.post([this]() -> void { drainSubmissions(); });
+  }
+}
+
+size_t StreamRings::harvest(envoy_stream_completion* completions, size_t max) {
+  size_t harvested = 0;
+  while (harvested < max && completions_.pop(completions[harvested])) {
+    harvested++;
+  }
+  if (harvested == max || !overflowed_.load()) {
+    return harvested;
+  }
+
+  Thread::LockGuard lock(overflow_lock_);
+  // Overflowed events may only be harvested once every event that entered the ring ahead of them
+  // has been.
+  if (!completions_.empty()) {
+    return harvested;
+  }
+  while (harvested < max && !overflow_.empty()) {
+    completions[harvested++] = overflow_.front();
+    overflow_.pop_front();
+  }
+  if (overflow_.empty()) {
+    overflowed_.store(false);
+  }
+  return harvested;
+}
+
+size_t StreamRings::poll(envoy_stream_completion* completions, size_t max,
+                         std::chrono::milliseconds timeout) {
+  size_t harvested = harvest(completions, max);
+  if (harvested > 0 || max == 0 || timeout.count() <= 0) {
+    return harvested;
+  }
+
+  Thread::LockGuard lock(poll_lock_);
+  pollers_++;
+  // Either complete() counted its event before this load, in which case the event is visible to
+  // the harvest below, or it will observe this poller and signal it once it is waiting.
+  const uint64_t completed = completed_.load();
+  harvested = harvest(completions, max);
+  if (harvested == 0 && completed_.load() == completed) {
+    poll_cv_.waitFor(poll_lock_, timeout);
+    harvested = harvest(completions, max);
+  }
+  pollers_--;
+  return harvested;
+}
+
+void StreamRings::complete(envoy_stream_completion completion) {
+  if (overflowed_.load() || !completions_.push(completion)) {
+    Thread::LockGuard lock(overflow_lock_);
+    overflow_.push_back(completion);
+    overflowed_.store(true);
+  }
+
+  completed_++;
+  if (pollers_.load() > 0) {
+    Thread::LockGuard lock(poll_lock_);
+    poll_cv_.notifyOne();
+  }
+}
+
+envoy_http_callbacks StreamRings::callbacksFor(envoy_stream_t stream) {
+  envoy_http_callbacks callbacks{};
+  callbacks.on_headers = &StreamRings::onHeaders;
+  callbacks.on_data = &StreamRings::onData;
+  callbacks.on_trailers = &StreamRings::onTrailers;
+  callbacks.on_error = &StreamRings::onError;
+  callbacks.on_complete = &StreamRings::onComplete;
+  callbacks.on_cancel = &StreamRings::onCancel;
+  // Released by whichever terminal callback fires.
+  callbacks.context = new StreamContext{*this, stream};
+  return callbacks;
+}
+
+void* StreamRings::onHeaders(envoy_headers headers, bool end_stream, void* context) {
+  auto* stream_context = static_cast<StreamContext*>(context);
+  envoy_stream_completion completion{};
+  completion.type = ENVOY_STREAM_COMPLETION_HEADERS;
+  completion.stream = stream_context->stream_;
+  completion.end_stream = end_stream;
+  completion.headers = headers;
+  stream_context->rings_.complete(completion);
+  return nullptr;
+}
+
+void* StreamRings::onData(envoy_data data, bool end_stream, void* context) {
+  auto* stream_context = static_cast<StreamContext*>(context);
+  envoy_stream_completion completion{};
+  completion.type = ENVOY_STREAM_COMPLETION_DATA;
+  completion.stream = stream_context->stream_;
+  completion.end_stream = end_stream;
+  completion.data = data;
+  stream_context->rings_.complete(completion);
+  return nullptr;
+}
+
+void* StreamRings::onTrailers(envoy_headers trailers, void* context) {
+  auto* stream_context = static_cast<StreamContext*>(context);
+  envoy_stream_completion completion{};
+  completion.type = ENVOY_STREAM_COMPLETION_TRAILERS;
+  completion.stream = stream_context->stream_;
+  completion.end_stream = true;
+  completion.headers = trailers;
+  stream_context->rings_.complete(completion);
+  return nullptr;
+}
+
+void* StreamRings::onError(envoy_error error, envoy_stream_intel stream_intel, void* context) {
+  auto* stream_context = static_cast<StreamContext*>(context);
+  envoy_stream_completion completion{};
+  completion.type = ENVOY_STREAM_COMPLETION_ERROR;
+  completion.stream = stream_context->stream_;
+  completion.error = error;
+  completion.stream_intel = stream_intel;
+  stream_context->rings_.complete(completion);
+  delete stream_context;
+  return nullptr;
+}
+
+void* StreamRings::onComplete(envoy_stream_intel stream_intel, void* context) {
+  auto* stream_context = static_cast<StreamContext*>(context);
+  envoy_stream_completion completion{};
+  completion.type = ENVOY_STREAM_COMPLETION_COMPLETE;
+  completion.stream = stream_context->stream_;
+  completion.stream_intel = stream_intel;
+  stream_context->rings_.complete(completion);
+  delete stream_context;
+  return nullptr;
+}
+
+void* StreamRings::onCancel(envoy_stream_intel stream_intel, void* context) {
+  auto* stream_context = static_cast<StreamContext*>(context);
+  envoy_stream_completion completion{};
+  completion.type = ENVOY_STREAM_COMPLETION_CANCEL;
+  completion.stream = stream_context->stream_;
+  completion.stream_intel = stream_intel;
+  stream_context->rings_.complete(completion);
+  delete stream_context;
+  return nullptr;
+}
+
+} // namespace Http
+} // namespace Envoy
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <list>
+
+#include "common/common/logger.h"
+#include "common/common/thread.h"
+
+#include "library/common/event/provisional_dispatcher.h"
+#include "library/common/thread/bounded_queue.h"
+#include "library/common/types/c_types.h"
+
+namespace Envoy {
+namespace Http {
+
+/**
+ * Optional ring-based interface between platform threads and an engine, in the style of io_uring.
+ *
+ * Platform threads push stream operations onto a lock-free submission ring; the engine applies
+ * them on its own thread, with one dispatcher post per batch. Streams started with callbacks from
+ * callbacksFor() report their events onto a completion ring rather than calling into the platform,
+ * so that any platform thread can harvest them in batches.
+ */
+class StreamRings : public Logger::Loggable<Logger::Id::http> {
+public:
+  using ApplyCb = std::function<void(const envoy_stream_operation* operations, size_t count)>;
+
+  /**
+   * @param dispatcher, the dispatcher on whose thread submitted operations are applied.
+   * @param apply, applies operations to the engine's Http::Client. Runs on the dispatcher's thread.
+   * @param submission_capacity, capacity of the submission ring. Must be a power of two.
+   * @param completion_capacity, capacity of the completion ring. Must be a power of two.
+   */
+  StreamRings(Event::ProvisionalDispatcher& dispatcher, ApplyCb apply, size_t submission_capacity,
+              size_t completion_capacity);
+
+  /**
+   * Pushes operations onto the submission ring. Safe to call from any thread.
+   * @param operations, the operations to submit, in order.
+   * @param count, the number of operations.
+   * @return size_t, the number of leading operations accepted. Fewer than count are accepted only
+   * if the ring is full; the remainder may be resubmitted later.
+   */
+  size_t submit(const envoy_stream_operation* operations, size_t count);
+
+  /**
+   * Pops events off the completion ring. Safe to call from any thread.
+   * @param completions, destination for harvested events.
+   * @param max, the maximum number of events to harvest.
+   * @return size_t, the number of events harvested.
+   */
+  size_t harvest(envoy_stream_completion* completions, size_t max);
+
+  /**
+   * Pops events off the completion ring, waiting for one to arrive if none are ready. Safe to call
+   * from any thread; the engine never waits on pollers, it only wakes them.
+   * @param completions, destination for harvested events.
+   * @param max, the maximum number of events to harvest.
+   * @param timeout, how long to wait for an event. Zero makes this equivalent to harvest().
+   * @return size_t, the number of events harvested. Zero if the timeout elapsed, and occasionally
+   * earlier if the event that caused the wakeup had already been harvested.
+   */
+  size_t poll(envoy_stream_completion* completions, size_t max, std::chrono::milliseconds timeout);
+
+  /**
+   * Builds callbacks that report a stream's events onto the completion ring. The callbacks must be
+   * used to start exactly one stream, the one identified by stream.
+   * @param stream, the stream the callbacks will be used with.
+   * @return envoy_http_callbacks, callbacks bound to this ring and stream.
+   */
+  envoy_http_callbacks callbacksFor(envoy_stream_t stream);
+
+private:
+  struct StreamContext {
+    StreamRings& rings_;
+    envoy_stream_t stream_;
+  };
+
+  static void* onHeaders(envoy_headers headers, bool end_stream, void* context);
+  static void* onData(envoy_data data, bool end_stream, void* context);
+  static void* onTrailers(envoy_headers trailers, void* context);
+  static void* onError(envoy_error error, envoy_stream_intel stream_intel, void* context);
+  static void* onComplete(envoy_stream_intel stream_intel, void* context);
+  static void* onCancel(envoy_stream_intel stream_intel, void* context);
+
+  // Applies queued submissions. Runs on the dispatcher's thread.
+  void drainSubmissions();
+  // Queues an event for harvesting. Safe to call from any engine thread: when an engine runs
+  // several workers, all of them report onto the primary's completion ring.
+  void complete(envoy_stream_completion completion);
+
+  Event::ProvisionalDispatcher& dispatcher_;
+  const ApplyCb apply_;
+  Thread::BoundedQueue<envoy_stream_operation> submissions_;
+  std::atomic<bool> drain_scheduled_{};
+  Thread::BoundedQueue<envoy_stream_completion> completions_;
+  // Events completed while completions_ was full. While any are pending, every event goes here so
+  // that each stream's events are harvested in order.
+  Thread::MutexBasicLockable overflow_lock_;
+  std::list<envoy_stream_completion> overflow_ GUARDED_BY(overflow_lock_);
+  std::atomic<bool> overflowed_{};
+  // Threads blocked in poll(). The engine only takes poll_lock_ to wake them if there are any.
+  Thread::MutexBasicLockable poll_lock_;
+  Thread::CondVar poll_cv_;
+  std::atomic<uint32_t> pollers_{};
+  std::atomic<uint64_t> completed_{};
+};
+
+using StreamRingsPtr = std::unique_ptr<StreamRings>;
+
+} // namespace Http
+} // namespace Envoy
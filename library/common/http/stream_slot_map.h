@@ -0,0 +1,147 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "common/common/assert.h"
+
+#include "absl/container/flat_hash_map.h"
+#include "library/common/types/c_types.h"
+
+namespace Envoy {
+namespace Http {
+
+/**
+ * Owning map from stream handle to stream state, specialized for the way handles are issued:
+ * sequentially per engine, so that the low bits of the live handles rarely coincide.
+ *
+ * Each handle maps directly to a slot by its low bits, and the slot stores the full handle, so a
+ * lookup is a mask, an index and a compare. When an engine shards its handles across workers, each
+ * map only sees every stride-th handle; those are divided by the stride first, so that they still
+ * fill consecutive slots. A stale handle whose slot has since been reused by a
+ * newer stream fails the compare and is rejected. The rare handle that collides with a live one in
+ * its slot is kept in an overflow map instead. The slot array grows to keep at most half of it
+ * occupied.
+ *
+ * Not thread-safe.
+ */
+template <class T> class StreamSlotMap {
+public:
+  using ValuePtr = std::unique_ptr<T>;
+
+  /**
+   * @param initial_capacity, the initial number of slots. Must be a power of two.
+   * @param stride, the distance between consecutive handles stored in this map.
+   */
+  explicit StreamSlotMap(size_t initial_capacity = 64, size_t stride = 1)
+      : slots_(initial_capacity), mask_(initial_capacity - 1), stride_(stride) {
+    ASSERT(initial_capacity > 0 && (initial_capacity & mask_) == 0);
+    ASSERT(stride > 0);
+  }
+
+  /**
+   * @return T*, the value stored for handle, or nullptr if there is none.
+   */
+  T* find(envoy_stream_t handle) const {
+    const Slot& slot = slots_[index(handle)];
+    if (slot.handle_ == handle && slot.value_ != nullptr) {
+      return slot.value_.get();
+    }
+    if (overflow_.empty()) {
+      return nullptr;
+    }
+    auto it = overflow_.find(handle);
+    return it != overflow_.end() ? it->second.get() : nullptr;
+  }
+
+  /**
+   * Store a value for a handle that is not already present.
+   */
+  void insert(envoy_stream_t handle, ValuePtr value) {
+    ASSERT(find(handle) == nullptr);
+    if ((size_ + 1) * 2 > slots_.size()) {
+      grow();
+    }
+    place(handle, std::move(value));
+    size_++;
+  }
+
+  /**
+   * Remove the value stored for handle.
+   * @return ValuePtr, the removed value, or nullptr if there was none.
+   */
+  ValuePtr erase(envoy_stream_t handle) {
+    ValuePtr value;
+    Slot& slot = slots_[index(handle)];
+    if (slot.handle_ == handle && slot.value_ != nullptr) {
+      value = std::move(slot.value_);
+    } else if (!overflow_.empty()) {
+      auto it = overflow_.find(handle);
+      if (it != overflow_.end()) {
+        value = std::move(it->second);
+        overflow_.erase(it);
+      }
+    }
+    if (value != nullptr) {
+      size_--;
+    }
+    return value;
+  }
+
+  /**
+   * @return size_t, the number of values stored.
+   */
+  size_t size() const { return size_; }
+
+  /**
+   * @return size_t, the number of values kept in the overflow map after colliding with a live
+   * handle.
+   */
+  size_t overflowSize() const { return overflow_.size(); }
+
+private:
+  struct Slot {
+    envoy_stream_t handle_{};
+    ValuePtr value_;
+  };
+
+  size_t index(envoy_stream_t handle) const {
+    const size_t position = static_cast<size_t>(handle);
+    return (stride_ == 1 ? position : position / stride_) & mask_;
+  }
+
+  void place(envoy_stream_t handle, ValuePtr value) {
+    Slot& slot = slots_[index(handle)];
+    if (slot.value_ == nullptr) {
+      slot.handle_ = handle;
+      slot.value_ = std::move(value);
+    } else {
+      overflow_.emplace(handle, std::move(value));
+    }
+  }
+
+  void grow() {
+    std::vector<Slot> slots(slots_.size() * 2);
+    slots.swap(slots_);
+    mask_ = slots_.size() - 1;
+    absl::flat_hash_map<envoy_stream_t, ValuePtr> overflow;
+    overflow.swap(overflow_);
+    for (Slot& slot : slots) {
+      if (slot.value_ != nullptr) {
+        place(slot.handle_, std::move(slot.value_));
+      }
+    }
+    for (auto& entry : overflow) {
+      place(entry.first, std::move(entry.second));
+    }
+  }
+
+  std::vector<Slot> slots_;
+  size_t mask_;
+  const size_t stride_;
+  size_t size_{};
+  absl::flat_hash_map<envoy_stream_t, ValuePtr> overflow_;
+};
+
+} // namespace Http
+} // namespace Envoy
@@ -320,6 +320,28 @@ static void* jvm_on_response_data(envoy_data data, bool end_stream, void* contex
   return jvm_on_data("onResponseData", data, end_stream, context);
 }
 
+static void* jvm_on_response_data_vector(envoy_data_vector data, bool end_stream,
+                                         void* context) {
+  jni_log("[Envoy]", "jvm_on_data_vector");
+  JNIEnv* env = get_env();
+  jobject j_context = static_cast<jobject>(context);
+
+  jclass jcls_JvmCallbackContext = env->GetObjectClass(j_context);
+  jmethodID jmid_onData =
+      env->GetMethodID(jcls_JvmCallbackContext, "onResponseData", "([BZ)Ljava/lang/Object;");
+
+  // Segments are copied straight into the JVM array, without first being coalesced natively.
+  jbyteArray j_data = native_data_vector_to_array(env, data);
+  jobject result =
+      env->CallObjectMethod(j_context, jmid_onData, j_data, end_stream ? JNI_TRUE : JNI_FALSE);
+
+  release_envoy_data_vector(data);
+  env->DeleteLocalRef(j_data);
+  env->DeleteLocalRef(jcls_JvmCallbackContext);
+
+  return result;
+}
+
 static envoy_filter_data_status jvm_http_filter_on_request_data(envoy_data data, bool end_stream,
                                                                 const void* context) {
   JNIEnv* env = get_env();
@@ -590,7 +612,26 @@ jvm_http_filter_on_resume_response(envoy_headers* headers, envoy_data* data,
                                    context);
 }
 
-static void* jvm_on_complete(void* context) {
+static void pass_jvm_stream_intel(envoy_stream_intel stream_intel, void* context) {
+  jni_log("[Envoy]", "jvm_on_stream_intel");
+
+  JNIEnv* env = get_env();
+  jobject j_context = static_cast<jobject>(context);
+
+  jclass jcls_JvmObserverContext = env->GetObjectClass(j_context);
+  jmethodID jmid_onStreamIntel =
+      env->GetMethodID(jcls_JvmObserverContext, "onStreamIntel", "(JJJJ)Ljava/lang/Object;");
+  jobject result = env->CallObjectMethod(
+      j_context, jmid_onStreamIntel, stream_intel.attempt_count,
+      stream_intel.upstream_service_time_ms, stream_intel.sent_byte_count,
+      stream_intel.received_byte_count);
+
+  env->DeleteLocalRef(result);
+  env->DeleteLocalRef(jcls_JvmObserverContext);
+}
+
+static void* jvm_on_complete(envoy_stream_intel stream_intel, void* context) {
+  pass_jvm_stream_intel(stream_intel, context);
   jni_delete_global_ref(context);
   return NULL;
 }
@@ -615,7 +656,8 @@ static void* call_jvm_on_error(envoy_error error, void* context) {
   return result;
 }
 
-static void* jvm_on_error(envoy_error error, void* context) {
+static void* jvm_on_error(envoy_error error, envoy_stream_intel stream_intel, void* context) {
+  pass_jvm_stream_intel(stream_intel, context);
   void* result = call_jvm_on_error(error, context);
   jni_delete_global_ref(context);
   return result;
@@ -636,12 +678,28 @@ static void* call_jvm_on_cancel(void* context) {
   return result;
 }
 
-static void* jvm_on_cancel(void* context) {
+static void* jvm_on_cancel(envoy_stream_intel stream_intel, void* context) {
+  pass_jvm_stream_intel(stream_intel, context);
   void* result = call_jvm_on_cancel(context);
   jni_delete_global_ref(context);
   return result;
 }
 
+static void* jvm_on_send_window_available(void* context) {
+  jni_log("[Envoy]", "jvm_on_send_window_available");
+
+  JNIEnv* env = get_env();
+  jobject j_context = static_cast<jobject>(context);
+
+  jclass jcls_JvmObserverContext = env->GetObjectClass(j_context);
+  jmethodID jmid_onSendWindowAvailable =
+      env->GetMethodID(jcls_JvmObserverContext, "onSendWindowAvailable", "()Ljava/lang/Object;");
+  jobject result = env->CallObjectMethod(j_context, jmid_onSendWindowAvailable);
+
+  env->DeleteLocalRef(jcls_JvmObserverContext);
+  return result;
+}
+
 static void jvm_http_filter_on_error(envoy_error error, const void* context) {
   call_jvm_on_error(error, const_cast<void*>(context));
 }
@@ -702,7 +760,7 @@ extern "C" JNIEXPORT jlong JNICALL Java_io_envoyproxy_envoymobile_engine_JniLibr
 }
 
 extern "C" JNIEXPORT jint JNICALL Java_io_envoyproxy_envoymobile_engine_JniLibrary_startStream(
-    JNIEnv* env, jclass, jlong stream_handle, jobject j_context) {
+    JNIEnv* env, jclass, jlong stream_handle, jobject j_context, jboolean explicit_flow_control) {
 
   jclass jcls_JvmCallbackContext = env->GetObjectClass(j_context);
 
@@ -715,9 +773,14 @@ extern "C" JNIEXPORT jint JNICALL Java_io_envoyproxy_envoymobile_engine_JniLibra
                                            jvm_on_error,
                                            jvm_on_complete,
                                            jvm_on_cancel,
-                                           retained_context};
+                                           retained_context,
+                                           jvm_on_response_data_vector,
+                                           jvm_on_send_window_available};
   envoy_status_t result =
-      start_stream(static_cast<envoy_stream_t>(stream_handle), native_callbacks);
+      explicit_flow_control
+          ? start_flow_controlled_stream(static_cast<envoy_stream_t>(stream_handle),
+                                         native_callbacks, 0 /* default buffer limit */)
+          : start_stream(static_cast<envoy_stream_t>(stream_handle), native_callbacks);
   if (result != ENVOY_SUCCESS) {
     env->DeleteGlobalRef(retained_context); // No callbacks are fired and we need to release
   }
@@ -811,6 +874,13 @@ extern "C" JNIEXPORT jint JNICALL Java_io_envoyproxy_envoymobile_engine_JniLibra
                    end_stream);
 }
 
+extern "C" JNIEXPORT jint JNICALL Java_io_envoyproxy_envoymobile_engine_JniLibrary_sendDataVector(
+    JNIEnv* env, jclass, jlong stream_handle, jobjectArray data, jboolean end_stream) {
+
+  return send_data_vector(static_cast<envoy_stream_t>(stream_handle),
+                          buffers_to_native_data_vector(env, data), end_stream);
+}
+
 extern "C" JNIEXPORT jint JNICALL Java_io_envoyproxy_envoymobile_engine_JniLibrary_sendHeaders(
     JNIEnv* env, jclass, jlong stream_handle, jobjectArray headers, jboolean end_stream) {
 
@@ -831,6 +901,12 @@ extern "C" JNIEXPORT jint JNICALL Java_io_envoyproxy_envoymobile_engine_JniLibra
   return reset_stream(static_cast<envoy_stream_t>(stream_handle));
 }
 
+extern "C" JNIEXPORT jint JNICALL Java_io_envoyproxy_envoymobile_engine_JniLibrary_readData(
+    JNIEnv* env, jclass, jlong stream_handle, jlong byte_count) {
+
+  return read_data(static_cast<envoy_stream_t>(stream_handle), static_cast<size_t>(byte_count));
+}
+
 // EnvoyStringAccessor
 
 extern "C" JNIEXPORT jint JNICALL
@@ -54,11 +54,11 @@ int unbox_integer(JNIEnv* env, jobject boxedInteger) {
 
 envoy_data array_to_native_data(JNIEnv* env, jbyteArray j_data) {
   size_t data_length = env->GetArrayLength(j_data);
-  uint8_t* native_bytes = static_cast<uint8_t*>(safe_malloc(data_length));
+  uint8_t* native_bytes = static_cast<uint8_t*>(safe_pool_malloc(data_length));
   void* critical_data = env->GetPrimitiveArrayCritical(j_data, 0);
   memcpy(native_bytes, critical_data, data_length); // NOLINT(safe-memcpy)
   env->ReleasePrimitiveArrayCritical(j_data, critical_data, 0);
-  return {data_length, native_bytes, free, native_bytes};
+  return {data_length, native_bytes, envoy_pool_release, native_bytes};
 }
 
 jstring native_data_to_string(JNIEnv* env, envoy_data data) {
@@ -78,6 +78,19 @@ jbyteArray native_data_to_array(JNIEnv* env, envoy_data data) {
   return j_data;
 }
 
+jbyteArray native_data_vector_to_array(JNIEnv* env, envoy_data_vector data) {
+  jbyteArray j_data = env->NewByteArray(envoy_data_vector_length(data));
+  void* critical_data = env->GetPrimitiveArrayCritical(j_data, nullptr);
+  RELEASE_ASSERT(critical_data != nullptr, "unable to allocate memory in jni_utility");
+  uint8_t* dst = static_cast<uint8_t*>(critical_data);
+  for (envoy_data_vector_size_t i = 0; i < data.length; i++) {
+    memcpy(dst, data.segments[i].bytes, data.segments[i].length); // NOLINT(safe-memcpy)
+    dst += data.segments[i].length;
+  }
+  env->ReleasePrimitiveArrayCritical(j_data, critical_data, 0);
+  return j_data;
+}
+
 envoy_data buffer_to_native_data(JNIEnv* env, jobject j_data) {
   uint8_t* direct_address = static_cast<uint8_t*>(env->GetDirectBufferAddress(j_data));
 
@@ -119,6 +132,23 @@ envoy_data* buffer_to_native_data_ptr(JNIEnv* env, jobject j_data) {
   return native_data;
 }
 
+envoy_data_vector buffers_to_native_data_vector(JNIEnv* env, jobjectArray j_buffers) {
+  envoy_data_vector_size_t length = env->GetArrayLength(j_buffers);
+  if (length == 0) {
+    return envoy_nodata_vector;
+  }
+
+  envoy_data* segments = static_cast<envoy_data*>(safe_malloc(sizeof(envoy_data) * length));
+  for (envoy_data_vector_size_t i = 0; i < length; i++) {
+    jobject j_buffer = env->GetObjectArrayElement(j_buffers, i);
+    segments[i] = buffer_to_native_data(env, j_buffer);
+    env->DeleteLocalRef(j_buffer);
+  }
+
+  // Each segment holds its own reference to its buffer, so the vector only owns the array.
+  return {length, segments, free, segments};
+}
+
 envoy_headers to_native_headers(JNIEnv* env, jobjectArray headers) {
   return to_native_map(env, headers);
 }
@@ -32,12 +32,24 @@ envoy_data array_to_native_data(JNIEnv* env, jbyteArray j_data);
  */
 jbyteArray native_data_to_array(JNIEnv* env, envoy_data data);
 
+/**
+ * Utility function that copies the segments of an envoy_data_vector into a single jbyteArray.
+ *
+ * @param env, the JNI env pointer.
+ * @param data, the source to copy from.
+ *
+ * @return jbyteArray, copied data. It is up to the function caller to clean up memory.
+ */
+jbyteArray native_data_vector_to_array(JNIEnv* env, envoy_data_vector data);
+
 jstring native_data_to_string(JNIEnv* env, envoy_data data);
 
 envoy_data buffer_to_native_data(JNIEnv* env, jobject j_data);
 
 envoy_data* buffer_to_native_data_ptr(JNIEnv* env, jobject j_data);
 
+envoy_data_vector buffers_to_native_data_vector(JNIEnv* env, jobjectArray j_buffers);
+
 envoy_headers to_native_headers(JNIEnv* env, jobjectArray headers);
 
 envoy_headers* to_native_headers_ptr(JNIEnv* env, jobjectArray headers);
@@ -1,41 +1,120 @@
 #include "library/common/main_interface.h"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <memory>
 #include <string>
+#include <vector>
+
+#include "common/common/lock_guard.h"
+#include "common/common/thread.h"
 
 #include "library/common/api/external.h"
 #include "library/common/engine.h"
+#include "library/common/engine_handle.h"
 #include "library/common/extensions/filters/http/platform_bridge/c_types.h"
 #include "library/common/http/client.h"
 
 // NOLINT(namespace-envoy)
 
-static Envoy::EngineSharedPtr strong_engine_;
-static Envoy::EngineWeakPtr engine_;
-static std::atomic<envoy_stream_t> current_stream_handle_{0};
+// Engines by handle, read and written with std::atomic_load and std::atomic_store. Lookups take a
+// reference, so that calls racing with terminate_engine fail cleanly rather than touching freed
+// memory. Once terminated, an engine's handle is released for reuse by a later init_engine.
+static std::shared_ptr<Envoy::EngineHandle> engine_handles_[Envoy::EngineHandle::MaxHandle + 1];
+// Serializes handle allocation and release.
+static Envoy::Thread::MutexBasicLockable engine_handles_mutex_;
+// Where stream numbering continues for the next engine to reuse a released handle. Guarded by
+// engine_handles_mutex_.
+static envoy_stream_t released_engine_next_streams_[Envoy::EngineHandle::MaxHandle + 1];
+static std::atomic<envoy_engine_t> default_engine_handle_{0};
 static std::atomic<envoy_network_t> preferred_network_{ENVOY_NET_GENERIC};
 
-static std::shared_ptr<Envoy::Engine> engine() {
-  // TODO(goaway): enable configurable heap-based allocation
-  return engine_.lock();
+static std::shared_ptr<Envoy::EngineHandle> engine_handle(envoy_engine_t engine) {
+  // 0 addresses the most recently initialized engine, for callers that predate multiple engines.
+  if (engine == 0) {
+    engine = default_engine_handle_.load();
+  }
+  if (engine <= 0 || engine > Envoy::EngineHandle::MaxHandle) {
+    return nullptr;
+  }
+  return std::atomic_load(&engine_handles_[engine]);
+}
+
+// The primary worker of an engine, which serves engine-level calls.
+static std::shared_ptr<Envoy::Engine> primary_engine(envoy_engine_t engine) {
+  auto handle = engine_handle(engine);
+  return handle != nullptr ? handle->primary() : nullptr;
+}
+
+// The engine worker that a stream is pinned to.
+static std::shared_ptr<Envoy::Engine> stream_engine(envoy_stream_t stream) {
+  auto handle = engine_handle(Envoy::EngineHandle::handleForStream(stream));
+  return handle != nullptr ? handle->worker(stream) : nullptr;
+}
+
+// When the platform made a call, for measuring stream latency. Read from the engine's time source,
+// which its client measures the rest of the stream's phases against.
+static Envoy::MonotonicTime api_call_time(Envoy::Engine& e) {
+  return e.timeSource().monotonicTime();
+}
+
+static envoy_status_t post_stream_operations(std::vector<envoy_stream_operation> batch) {
+  const envoy_stream_t stream = batch.empty() ? 0 : batch.front().stream;
+  if (auto e = stream_engine(stream)) {
+    return e->dispatcher().post(
+        [stream, batch = std::move(batch), time = api_call_time(*e)]() -> void {
+          if (auto e = stream_engine(stream))
+            e->httpClient().applyStreamOperations(batch.data(), batch.size(), time);
+        });
+  }
+  return ENVOY_FAILURE;
 }
 
-envoy_stream_t init_stream(envoy_engine_t) { return current_stream_handle_++; }
+envoy_stream_t init_stream(envoy_engine_t engine) {
+  auto handle = engine_handle(engine);
+  return handle != nullptr ? handle->initStream() : 0;
+}
 
 envoy_status_t start_stream(envoy_stream_t stream, envoy_http_callbacks callbacks) {
-  if (auto e = engine()) {
-    return e->dispatcher().post([stream, callbacks]() -> void {
-      if (auto e = engine())
-        e->httpClient().startStream(stream, callbacks);
+  if (auto e = stream_engine(stream)) {
+    return e->dispatcher().post([stream, callbacks, time = api_call_time(*e)]() -> void {
+      if (auto e = stream_engine(stream))
+        e->httpClient().startStream(stream, callbacks, false, time);
+    });
+  }
+  return ENVOY_FAILURE;
+}
+
+envoy_status_t start_flow_controlled_stream(envoy_stream_t stream, envoy_http_callbacks callbacks,
+                                            uint32_t buffer_limit) {
+  if (buffer_limit == 0) {
+    buffer_limit = Envoy::Http::Client::DefaultBufferLimit;
+  }
+  if (auto e = stream_engine(stream)) {
+    return e->dispatcher().post(
+        [stream, callbacks, buffer_limit, time = api_call_time(*e)]() -> void {
+          if (auto e = stream_engine(stream))
+            e->httpClient().startStream(stream, callbacks, true, time, buffer_limit);
+        });
+  }
+  return ENVOY_FAILURE;
+}
+
+envoy_status_t read_data(envoy_stream_t stream, size_t bytes_to_read) {
+  if (auto e = stream_engine(stream)) {
+    return e->dispatcher().post([stream, bytes_to_read]() -> void {
+      if (auto e = stream_engine(stream))
+        e->httpClient().readData(stream, bytes_to_read);
     });
   }
   return ENVOY_FAILURE;
 }
 
 envoy_status_t send_headers(envoy_stream_t stream, envoy_headers headers, bool end_stream) {
-  if (auto e = engine()) {
+  if (auto e = stream_engine(stream)) {
     return e->dispatcher().post([stream, headers, end_stream]() -> void {
-      if (auto e = engine())
+      if (auto e = stream_engine(stream))
         e->httpClient().sendHeaders(stream, headers, end_stream);
     });
   }
@@ -43,32 +122,171 @@ envoy_status_t send_headers(envoy_stream_t stream, envoy_headers headers, bool e
 }
 
 envoy_status_t send_data(envoy_stream_t stream, envoy_data data, bool end_stream) {
-  if (auto e = engine()) {
+  if (auto e = stream_engine(stream)) {
     return e->dispatcher().post([stream, data, end_stream]() -> void {
-      if (auto e = engine())
+      if (auto e = stream_engine(stream))
         e->httpClient().sendData(stream, data, end_stream);
     });
   }
   return ENVOY_FAILURE;
 }
 
+envoy_status_t send_data_vector(envoy_stream_t stream, envoy_data_vector data, bool end_stream) {
+  if (auto e = stream_engine(stream)) {
+    return e->dispatcher().post([stream, data, end_stream]() -> void {
+      if (auto e = stream_engine(stream))
+        e->httpClient().sendDataVector(stream, data, end_stream);
+    });
+  }
+  return ENVOY_FAILURE;
+}
+
 // TODO: implement.
 envoy_status_t send_metadata(envoy_stream_t, envoy_headers) { return ENVOY_FAILURE; }
 
 envoy_status_t send_trailers(envoy_stream_t stream, envoy_headers trailers) {
-  if (auto e = engine()) {
+  if (auto e = stream_engine(stream)) {
     return e->dispatcher().post([stream, trailers]() -> void {
-      if (auto e = engine())
+      if (auto e = stream_engine(stream))
         e->httpClient().sendTrailers(stream, trailers);
     });
   }
   return ENVOY_FAILURE;
 }
 
+envoy_status_t send_stream_operations(const envoy_stream_operation* operations, size_t count) {
+  // Split the batch by the engine worker each stream is pinned to. Order is preserved for each
+  // stream, but not across streams on different workers.
+  std::vector<std::pair<Envoy::Engine*, std::vector<envoy_stream_operation>>> batches;
+  for (size_t i = 0; i < count; i++) {
+    auto e = stream_engine(operations[i].stream);
+    auto it = std::find_if(batches.begin(), batches.end(),
+                           [&e](const auto& batch) -> bool { return batch.first == e.get(); });
+    if (it == batches.end()) {
+      batches.emplace_back(e.get(), std::vector<envoy_stream_operation>());
+      it = batches.end() - 1;
+    }
+    it->second.push_back(operations[i]);
+  }
+  if (batches.size() == 1) {
+    return post_stream_operations(std::move(batches.front().second));
+  }
+
+  envoy_status_t status = batches.empty() ? ENVOY_FAILURE : ENVOY_SUCCESS;
+  for (auto& batch : batches) {
+    if (post_stream_operations(std::move(batch.second)) != ENVOY_SUCCESS) {
+      status = ENVOY_FAILURE;
+    }
+  }
+  return status;
+}
+
+envoy_status_t send_request(envoy_stream_t stream, envoy_http_callbacks callbacks,
+                            envoy_headers headers, const envoy_data* body,
+                            const envoy_headers* trailers) {
+  envoy_stream_operation operations[4] = {};
+  size_t count = 0;
+
+  operations[count].type = ENVOY_STREAM_OP_START;
+  operations[count++].callbacks = callbacks;
+  operations[count].type = ENVOY_STREAM_OP_HEADERS;
+  operations[count].end_stream = body == nullptr && trailers == nullptr;
+  operations[count++].headers = headers;
+  if (body != nullptr) {
+    operations[count].type = ENVOY_STREAM_OP_DATA;
+    operations[count].end_stream = trailers == nullptr;
+    operations[count++].data = *body;
+  }
+  if (trailers != nullptr) {
+    operations[count].type = ENVOY_STREAM_OP_TRAILERS;
+    operations[count++].headers = *trailers;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    operations[i].stream = stream;
+  }
+  return send_stream_operations(operations, count);
+}
+
+envoy_status_t init_stream_rings(envoy_engine_t engine, size_t submission_capacity,
+                                 size_t completion_capacity) {
+  if (auto handle = engine_handle(engine)) {
+    return handle->initStreamRings(submission_capacity, completion_capacity);
+  }
+  return ENVOY_FAILURE;
+}
+
+envoy_http_callbacks stream_ring_callbacks(envoy_engine_t engine, envoy_stream_t stream) {
+  // Every worker reports onto the primary's completion ring.
+  if (auto e = primary_engine(engine)) {
+    if (auto* rings = e->streamRings()) {
+      return rings->callbacksFor(stream);
+    }
+  }
+  return envoy_http_callbacks{};
+}
+
+size_t submit_stream_operations(envoy_engine_t engine, const envoy_stream_operation* operations,
+                                size_t count) {
+  auto handle = engine_handle(engine);
+  if (handle == nullptr) {
+    return 0;
+  }
+  if (handle->workerCount() == 1) {
+    if (auto e = handle->primary()) {
+      if (auto* rings = e->streamRings()) {
+        return rings->submit(operations, count);
+      }
+    }
+    return 0;
+  }
+
+  // Each worker applies its own streams' operations; stop at the first one that does not fit so
+  // that only a leading run is accepted.
+  size_t accepted = 0;
+  while (accepted < count) {
+    auto e = handle->worker(operations[accepted].stream);
+    auto* rings = e ? e->streamRings() : nullptr;
+    if (rings == nullptr || rings->submit(&operations[accepted], 1) == 0) {
+      break;
+    }
+    accepted++;
+  }
+  return accepted;
+}
+
+size_t harvest_stream_completions(envoy_engine_t engine, envoy_stream_completion* completions,
+                                  size_t max) {
+  if (auto e = primary_engine(engine)) {
+    if (auto* rings = e->streamRings()) {
+      return rings->harvest(completions, max);
+    }
+  }
+  return 0;
+}
+
+envoy_status_t start_polled_stream(envoy_engine_t engine, envoy_stream_t stream) {
+  envoy_http_callbacks callbacks = stream_ring_callbacks(engine, stream);
+  if (callbacks.context == nullptr) {
+    return ENVOY_FAILURE;
+  }
+  return start_stream(stream, callbacks);
+}
+
+size_t poll_completions(envoy_engine_t engine, envoy_stream_completion* completions, size_t max,
+                        uint64_t timeout_ms) {
+  if (auto e = primary_engine(engine)) {
+    if (auto* rings = e->streamRings()) {
+      return rings->poll(completions, max, std::chrono::milliseconds(timeout_ms));
+    }
+  }
+  return 0;
+}
+
 envoy_status_t reset_stream(envoy_stream_t stream) {
-  if (auto e = engine()) {
+  if (auto e = stream_engine(stream)) {
     return e->dispatcher().post([stream]() -> void {
-      if (auto e = engine())
+      if (auto e = stream_engine(stream))
         e->httpClient().cancelStream(stream);
     });
   }
@@ -80,66 +298,57 @@ envoy_status_t set_preferred_network(envoy_network_t network) {
   return ENVOY_SUCCESS;
 }
 
-envoy_status_t record_counter_inc(envoy_engine_t, const char* elements, envoy_stats_tags tags,
-                                  uint64_t count) {
-  // TODO: use specific engine once multiple engine support is in place.
-  // https://github.com/lyft/envoy-mobile/issues/332
-  if (auto e = engine()) {
-    return e->dispatcher().post([name = std::string(elements), tags, count]() -> void {
-      if (auto e = engine())
+envoy_status_t record_counter_inc(envoy_engine_t engine, const char* elements,
+                                  envoy_stats_tags tags, uint64_t count) {
+  if (auto e = primary_engine(engine)) {
+    return e->dispatcher().post([engine, name = std::string(elements), tags, count]() -> void {
+      if (auto e = primary_engine(engine))
         e->recordCounterInc(name, tags, count);
     });
   }
   return ENVOY_FAILURE;
 }
 
-envoy_status_t record_gauge_set(envoy_engine_t, const char* elements, envoy_stats_tags tags,
+envoy_status_t record_gauge_set(envoy_engine_t engine, const char* elements, envoy_stats_tags tags,
                                 uint64_t value) {
-  // TODO: use specific engine once multiple engine support is in place.
-  // https://github.com/lyft/envoy-mobile/issues/332
-  if (auto e = engine()) {
-    return e->dispatcher().post([name = std::string(elements), tags, value]() -> void {
-      if (auto e = engine())
+  if (auto e = primary_engine(engine)) {
+    return e->dispatcher().post([engine, name = std::string(elements), tags, value]() -> void {
+      if (auto e = primary_engine(engine))
         e->recordGaugeSet(name, tags, value);
     });
   }
   return ENVOY_FAILURE;
 }
 
-envoy_status_t record_gauge_add(envoy_engine_t, const char* elements, envoy_stats_tags tags,
+envoy_status_t record_gauge_add(envoy_engine_t engine, const char* elements, envoy_stats_tags tags,
                                 uint64_t amount) {
-  // TODO: use specific engine once multiple engine support is in place.
-  // https://github.com/lyft/envoy-mobile/issues/332
-  if (auto e = engine()) {
-    return e->dispatcher().post([name = std::string(elements), tags, amount]() -> void {
-      if (auto e = engine())
+  if (auto e = primary_engine(engine)) {
+    return e->dispatcher().post([engine, name = std::string(elements), tags, amount]() -> void {
+      if (auto e = primary_engine(engine))
         e->recordGaugeAdd(name, tags, amount);
     });
   }
   return ENVOY_FAILURE;
 }
 
-envoy_status_t record_gauge_sub(envoy_engine_t, const char* elements, envoy_stats_tags tags,
+envoy_status_t record_gauge_sub(envoy_engine_t engine, const char* elements, envoy_stats_tags tags,
                                 uint64_t amount) {
-  // TODO: use specific engine once multiple engine support is in place.
-  // https://github.com/lyft/envoy-mobile/issues/332
-  if (auto e = engine()) {
-    return e->dispatcher().post([name = std::string(elements), tags, amount]() -> void {
-      if (auto e = engine())
+  if (auto e = primary_engine(engine)) {
+    return e->dispatcher().post([engine, name = std::string(elements), tags, amount]() -> void {
+      if (auto e = primary_engine(engine))
         e->recordGaugeSub(name, tags, amount);
     });
   }
   return ENVOY_FAILURE;
 }
 
-envoy_status_t record_histogram_value(envoy_engine_t, const char* elements, envoy_stats_tags tags,
-                                      uint64_t value, envoy_histogram_stat_unit_t unit_measure) {
-  // TODO: use specific engine once multiple engine support is in place.
-  // https://github.com/lyft/envoy-mobile/issues/332
-  if (auto e = engine()) {
+envoy_status_t record_histogram_value(envoy_engine_t engine, const char* elements,
+                                      envoy_stats_tags tags, uint64_t value,
+                                      envoy_histogram_stat_unit_t unit_measure) {
+  if (auto e = primary_engine(engine)) {
     return e->dispatcher().post(
-        [name = std::string(elements), tags, value, unit_measure]() -> void {
-          if (auto e = engine())
+        [engine, name = std::string(elements), tags, value, unit_measure]() -> void {
+          if (auto e = primary_engine(engine))
             e->recordHistogramValue(name, tags, value, unit_measure);
         });
   }
@@ -151,29 +360,67 @@ envoy_status_t register_platform_api(const char* name, void* api) {
   return ENVOY_SUCCESS;
 }
 
-envoy_engine_t init_engine(envoy_engine_callbacks callbacks, envoy_logger logger) {
-  // TODO(goaway): return new handle once multiple engine support is in place.
-  // https://github.com/lyft/envoy-mobile/issues/332
-  strong_engine_ = std::make_shared<Envoy::Engine>(callbacks, logger, preferred_network_);
-  engine_ = strong_engine_;
-  return 1;
+envoy_status_t set_engine_worker_count(envoy_engine_t engine, uint32_t worker_count) {
+  if (auto handle = engine_handle(engine)) {
+    return handle->setWorkerCount(worker_count);
+  }
+  return ENVOY_FAILURE;
 }
 
-envoy_status_t run_engine(envoy_engine_t, const char* config, const char* log_level) {
-  // This will change once multiple engine support is in place.
-  // https://github.com/lyft/envoy-mobile/issues/332
+envoy_status_t set_engine_fast_start(envoy_engine_t engine, bool fast_start) {
+  if (auto handle = engine_handle(engine)) {
+    return handle->setFastStart(fast_start);
+  }
+  return ENVOY_FAILURE;
+}
 
-  if (auto e = engine()) {
-    e->run(config, log_level);
+envoy_status_t register_engine_platform_api(envoy_engine_t engine, const char* name, void* api) {
+  if (auto handle = engine_handle(engine)) {
+    handle->apiRegistry().registerApi(std::string(name), api);
     return ENVOY_SUCCESS;
   }
+  return ENVOY_FAILURE;
+}
+
+envoy_engine_t init_engine(envoy_engine_callbacks callbacks, envoy_logger logger) {
+  Envoy::Thread::LockGuard lock(engine_handles_mutex_);
+  // Each engine is a complete Envoy server, and process-wide state such as the logger context, the
+  // log sink delegate chain and the runtime singleton supports only one of them at a time. A new
+  // engine may be initialized once the previous one has been terminated, which is synchronous.
+  for (envoy_engine_t engine = 1; engine <= Envoy::EngineHandle::MaxHandle; engine++) {
+    if (std::atomic_load(&engine_handles_[engine]) != nullptr) {
+      return -1;
+    }
+  }
+  for (envoy_engine_t engine = 1; engine <= Envoy::EngineHandle::MaxHandle; engine++) {
+    if (std::atomic_load(&engine_handles_[engine]) == nullptr) {
+      std::atomic_store(&engine_handles_[engine],
+                        std::make_shared<Envoy::EngineHandle>(
+                            engine, callbacks, logger, preferred_network_,
+                            released_engine_next_streams_[engine]));
+      default_engine_handle_.store(engine);
+      return engine;
+    }
+  }
+  return -1;
+}
 
+envoy_status_t run_engine(envoy_engine_t engine, const char* config, const char* log_level) {
+  if (auto handle = engine_handle(engine)) {
+    return handle->run(config, log_level);
+  }
   return ENVOY_FAILURE;
 }
 
-void terminate_engine(envoy_engine_t) {
-  // Reset the primary handle to the engine, but retain it long enough to synchronously terminate.
-  auto e = strong_engine_;
-  strong_engine_.reset();
-  e->terminate();
+void terminate_engine(envoy_engine_t engine) {
+  if (auto handle = engine_handle(engine)) {
+    handle->terminate();
+
+    Envoy::Thread::LockGuard lock(engine_handles_mutex_);
+    const envoy_engine_t released = handle->handle();
+    if (std::atomic_load(&engine_handles_[released]) == handle) {
+      released_engine_next_streams_[released] = handle->nextStream();
+      std::atomic_store(&engine_handles_[released], std::shared_ptr<Envoy::EngineHandle>());
+    }
+  }
 }
@@ -56,7 +56,8 @@ extern const char* fake_remote_listener_template;
 extern const char* stats_sink_template;
 
 /**
- * Initialize an underlying HTTP stream.
+ * Initialize an underlying HTTP stream. The stream handle identifies the engine that issued it, so
+ * calls that take only a stream are routed to that engine.
  * @param engine, handle to the engine that will manage this stream.
  * @return envoy_stream_t, handle to the underlying stream.
  */
@@ -71,6 +72,33 @@ envoy_stream_t init_stream(envoy_engine_t engine);
  */
 envoy_status_t start_stream(envoy_stream_t stream, envoy_http_callbacks callbacks);
 
+/**
+ * Open an underlying HTTP stream with explicit flow control: response data is buffered in Envoy
+ * and only delivered once the platform grants a read window with read_data. While more than
+ * buffer_limit bytes are buffered, Envoy stops reading the response from the upstream, and it
+ * resumes once no more than half of buffer_limit are.
+ * Uploads are paced the same way: after each non-final send_data, the platform should wait for
+ * the on_send_window_available callback before sending more data.
+ * @param stream, handle to the stream to be started.
+ * @param callbacks, the callbacks that will run the stream callbacks.
+ * @param buffer_limit, the stream's buffer limit in bytes, or 0 for the default of 65000. This also
+ * bounds how much of the stream Envoy's filters may buffer.
+ * @return envoy_status_t, the resulting status of the operation.
+ */
+envoy_status_t start_flow_controlled_stream(envoy_stream_t stream, envoy_http_callbacks callbacks,
+                                            uint32_t buffer_limit);
+
+/**
+ * Grant a read window on a stream started with start_flow_controlled_stream. Up to bytes_to_read
+ * bytes of response data are delivered in a single on_data call, as soon as any are available.
+ * Windows do not accumulate: a call made before the previous window has been used replaces it
+ * rather than adding to it. The platform should call read_data again once it is ready for more.
+ * @param stream, the stream to read from.
+ * @param bytes_to_read, the maximum number of bytes to deliver. Must be greater than zero.
+ * @return envoy_status_t, the resulting status of the operation.
+ */
+envoy_status_t read_data(envoy_stream_t stream, size_t bytes_to_read);
+
 /**
  * Send headers over an open HTTP stream. This method can be invoked once and needs to be called
  * before send_data.
@@ -90,6 +118,33 @@ envoy_status_t send_headers(envoy_stream_t stream, envoy_headers headers, bool e
  */
 envoy_status_t send_data(envoy_stream_t stream, envoy_data data, bool end_stream);
 
+/**
+ * Send scatter-gather data over an open HTTP stream. This method can be invoked multiple times.
+ * Segments are handed to Envoy without being coalesced.
+ * @param stream, the stream to send data over.
+ * @param data, the data to send.
+ * @param end_stream, supplies whether this is the last data in the stream.
+ * @return envoy_status_t, the resulting status of the operation.
+ */
+envoy_status_t send_data_vector(envoy_stream_t stream, envoy_data_vector data, bool end_stream);
+
+/**
+ * Start a stream and send a complete request over it in a single dispatch to Envoy's thread. This
+ * is equivalent to start_stream followed by send_headers, send_data and send_trailers as
+ * applicable, with the request ending on the last frame supplied.
+ * @param stream, handle to the stream to be started, as returned by init_stream.
+ * @param callbacks, the callbacks that will run the stream callbacks.
+ * @param headers, the request headers.
+ * @param body, the request body, or NULL if there is none. The envoy_data is copied; ownership of
+ * its bytes passes to Envoy.
+ * @param trailers, the request trailers, or NULL if there are none. The envoy_headers is copied;
+ * ownership of its entries passes to Envoy.
+ * @return envoy_status_t, the resulting status of the operation.
+ */
+envoy_status_t send_request(envoy_stream_t stream, envoy_http_callbacks callbacks,
+                            envoy_headers headers, const envoy_data* body,
+                            const envoy_headers* trailers);
+
 /**
  * Send metadata over an HTTP stream. This method can be invoked multiple times.
  * @param stream, the stream to send metadata over.
@@ -107,6 +162,87 @@ envoy_status_t send_metadata(envoy_stream_t stream, envoy_headers metadata);
  */
 envoy_status_t send_trailers(envoy_stream_t stream, envoy_headers trailers);
 
+/**
+ * Submit a batch of operations, on one or many streams, to be applied in array order in a single
+ * dispatch to Envoy's thread. This is equivalent to calling the single-operation functions in turn,
+ * but costs one cross-thread handoff for the whole batch.
+ * @param operations, the operations to submit. The array itself is copied and remains owned by the
+ * caller; ownership of each operation's payload passes to Envoy.
+ * @param count, the number of operations in the batch.
+ * @return envoy_status_t, the resulting status of the submission.
+ */
+envoy_status_t send_stream_operations(const envoy_stream_operation* operations, size_t count);
+
+/**
+ * Set up an engine's submission and completion rings. Must be called before any other stream ring
+ * function is used with the engine; subsequent calls have no effect.
+ * @param engine, the engine to set up the rings for.
+ * @param submission_capacity, capacity of the submission ring. Must be a power of two.
+ * @param completion_capacity, capacity of the completion ring. Must be a power of two.
+ * @return envoy_status_t, the resulting status of the operation.
+ */
+envoy_status_t init_stream_rings(envoy_engine_t engine, size_t submission_capacity,
+                                 size_t completion_capacity);
+
+/**
+ * Build callbacks that report a stream's events onto the engine's completion ring, to be harvested
+ * with harvest_stream_completions rather than delivered as calls into the platform. The callbacks
+ * must be used to start exactly one stream, the one identified by stream.
+ * @param engine, the engine whose completion ring should receive the events.
+ * @param stream, the stream the callbacks will be used with.
+ * @return envoy_http_callbacks, the callbacks, all null if the rings are not set up.
+ */
+envoy_http_callbacks stream_ring_callbacks(envoy_engine_t engine, envoy_stream_t stream);
+
+/**
+ * Push operations onto the engine's submission ring without blocking. Operations are applied in
+ * order on Envoy's thread, with a single cross-thread handoff for everything queued in the
+ * meantime.
+ * @param engine, the engine to submit to. Every operation must be on a stream of this engine.
+ * @param operations, the operations to submit. Ownership of each accepted operation's payload
+ * passes to Envoy.
+ * @param count, the number of operations.
+ * @return size_t, the number of leading operations accepted. The rest were not accepted because the
+ * ring was full, remain owned by the caller, and may be resubmitted.
+ */
+size_t submit_stream_operations(envoy_engine_t engine, const envoy_stream_operation* operations,
+                                size_t count);
+
+/**
+ * Pop stream events off the engine's completion ring without blocking.
+ * @param engine, the engine to harvest from.
+ * @param completions, destination for harvested events. Ownership of each event's payload passes
+ * to the caller.
+ * @param max, the maximum number of events to harvest.
+ * @return size_t, the number of events harvested.
+ */
+size_t harvest_stream_completions(envoy_engine_t engine, envoy_stream_completion* completions,
+                                  size_t max);
+
+/**
+ * Open an underlying HTTP stream in polling mode: rather than invoking platform callbacks on
+ * Envoy's thread, the stream's events are recorded onto the engine's completion ring, to be
+ * collected with poll_completions or harvest_stream_completions on the platform's own threads.
+ * init_stream_rings must have been called for the engine.
+ * @param engine, the engine whose completion ring should receive the events.
+ * @param stream, handle to the stream to be started.
+ * @return envoy_status_t, the resulting status of the operation.
+ */
+envoy_status_t start_polled_stream(envoy_engine_t engine, envoy_stream_t stream);
+
+/**
+ * Pop stream events off the engine's completion ring, blocking the calling thread until at least
+ * one is available or the timeout elapses.
+ * @param engine, the engine to poll.
+ * @param completions, destination for harvested events. Ownership of each event's payload passes
+ * to the caller.
+ * @param max, the maximum number of events to harvest.
+ * @param timeout_ms, how long to wait for an event, in milliseconds. Zero does not wait.
+ * @return size_t, the number of events harvested, possibly zero.
+ */
+size_t poll_completions(envoy_engine_t engine, envoy_stream_completion* completions, size_t max,
+                        uint64_t timeout_ms);
+
 /**
  * Detach all callbacks from a stream and send an interrupt upstream if supported by transport.
  * @param stream, the stream to evict.
@@ -185,13 +321,54 @@ envoy_status_t record_histogram_value(envoy_engine_t engine, const char* element
 envoy_status_t register_platform_api(const char* name, void* api);
 
 /**
- * Initialize an engine for handling network streams.
+ * Register an API leveraging platform libraries for use by a single engine. Extensions running on
+ * that engine see it in preference to one registered under the same name with
+ * register_platform_api(), and other engines do not see it at all.
+ * Warning: Must be completed before the engine is run with run_engine().
+ * @param engine, the engine the API is registered for.
+ * @param name, identifier of the platform API
+ * @param api, type-erased c struct containing function pointers and context.
+ * @return envoy_status_t, the resulting status of the operation.
+ */
+envoy_status_t register_engine_platform_api(envoy_engine_t engine, const char* name, void* api);
+
+/**
+ * Initialize an engine for handling network streams. Only one engine may be initialized at a time,
+ * as engines share process-wide logging and runtime state; another may be initialized once it has
+ * been terminated. The handle of an engine is released for reuse once it has been terminated, with
+ * stream handles continuing from those it issued. Wherever an engine handle is expected, 0 refers
+ * to the most recently initialized engine.
  * @param callbacks, the callbacks that will run the engine callbacks.
  * @param logger, optional callbacks to handle logging.
- * @return envoy_engine_t, handle to the underlying engine.
+ * @return envoy_engine_t, handle to the underlying engine, or -1 if another engine is initialized
+ * and not yet terminated. -1 is rejected wherever an engine handle is expected.
  */
 envoy_engine_t init_engine(envoy_engine_callbacks callbacks, envoy_logger logger);
 
+/**
+ * Set the number of workers an engine runs streams on. Each worker is a separate Envoy instance
+ * with its own thread, dispatcher, and connection pools, and streams are distributed across workers
+ * by handle. Pulse stats and platform logging are served by the first worker.
+ * Warning: Must be called after init_engine() and before run_engine(). Workers share process-wide
+ * logging and runtime state that supports only one Envoy instance, so counts above one are
+ * currently rejected.
+ * @param engine, handle to the engine to configure.
+ * @param worker_count, the number of workers. Only one is currently supported, the default.
+ * @return envoy_status_t, the resulting status of the operation.
+ */
+envoy_status_t set_engine_worker_count(envoy_engine_t engine, uint32_t worker_count);
+
+/**
+ * Let an engine start dispatching streams as soon as its event loop and ApiListener exist, instead
+ * of waiting for clusters to finish their initial DNS resolution. Only suitable for configurations
+ * that route through the dynamic forward proxy cluster, which resolves hosts per request.
+ * Warning: Must be called after init_engine() and before run_engine().
+ * @param engine, handle to the engine to configure.
+ * @param fast_start, whether to start early. Defaults to false.
+ * @return envoy_status_t, the resulting status of the operation.
+ */
+envoy_status_t set_engine_fast_start(envoy_engine_t engine, bool fast_start);
+
 /**
  * External entry point for library.
  * @param engine, handle to the engine to run.
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "common/common/assert.h"
+
+namespace Envoy {
+namespace Thread {
+
+/**
+ * Bounded lock-free multi-producer, multi-consumer FIFO queue (Dmitry Vyukov's array-based
+ * design). Each slot carries a sequence number that tells producers and consumers whether it is
+ * ready for them, so both operations are a single CAS on the shared position plus a release store
+ * on the slot. Neither operation allocates. A push that cannot complete because a slot is still
+ * being written or read by another thread appears as a full/empty queue rather than blocking.
+ */
+template <class T> class BoundedQueue {
+public:
+  /**
+   * @param capacity, the maximum number of queued elements. Must be a power of two.
+   */
+  explicit BoundedQueue(size_t capacity)
+      : mask_(capacity - 1), slots_(std::make_unique<Slot[]>(capacity)) {
+    RELEASE_ASSERT(capacity >= 2 && (capacity & mask_) == 0,
+                   "BoundedQueue capacity must be a power of two");
+    for (size_t i = 0; i < capacity; i++) {
+      slots_[i].sequence_.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * Appends an element. Safe to call from any thread.
+   * @param value, the element to append. Left untouched if the queue is full.
+   * @return bool, false if the queue was full.
+   */
+  bool push(T& value) {
+    size_t position = enqueue_position_.load(std::memory_order_relaxed);
+    Slot* slot;
+    for (;;) {
+      slot = &slots_[position & mask_];
+      const size_t sequence = slot->sequence_.load(std::memory_order_acquire);
+      const intptr_t difference =
+          static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+      if (difference == 0) {
+        if (enqueue_position_.compare_exchange_weak(position, position + 1,
+                                                    std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (difference < 0) {
+        return false;
+      } else {
+        position = enqueue_position_.load(std::memory_order_relaxed);
+      }
+    }
+    slot->value_ = std::move(value);
+    slot->sequence_.store(position + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Removes the oldest element. Safe to call from any thread.
+   * @param value, receives the removed element.
+   * @return bool, false if the queue was empty.
+   */
+  bool pop(T& value) {
+    size_t position = dequeue_position_.load(std::memory_order_relaxed);
+    Slot* slot;
+    for (;;) {
+      slot = &slots_[position & mask_];
+      const size_t sequence = slot->sequence_.load(std::memory_order_acquire);
+      const intptr_t difference =
+          static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+      if (difference == 0) {
+        if (dequeue_position_.compare_exchange_weak(position, position + 1,
+                                                    std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (difference < 0) {
+        return false;
+      } else {
+        position = dequeue_position_.load(std::memory_order_relaxed);
+      }
+    }
+    value = std::move(slot->value_);
+    // Leave the slot in a default state so that it does not keep resources of the element alive.
+    slot->value_ = T();
+    slot->sequence_.store(position + mask_ + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @return bool, whether no elements are queued or in the process of being queued. This is only a
+   * snapshot when other threads are pushing or popping concurrently.
+   */
+  bool empty() const {
+    return enqueue_position_.load(std::memory_order_acquire) ==
+           dequeue_position_.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @return size_t, the maximum number of queued elements.
+   */
+  size_t capacity() const { return mask_ + 1; }
+
+private:
+  // Sized to keep the hot positions on separate cache lines from each other and from the slots.
+  static constexpr size_t CacheLineSize = 64;
+
+  struct Slot {
+    std::atomic<size_t> sequence_;
+    T value_{};
+  };
+
+  const size_t mask_;
+  const std::unique_ptr<Slot[]> slots_;
+  alignas(CacheLineSize) std::atomic<size_t> enqueue_position_{0};
+  alignas(CacheLineSize) std::atomic<size_t> dequeue_position_{0};
+};
+
+} // namespace Thread
+} // namespace Envoy
@@ -5,6 +5,8 @@
 
 #include "common/common/assert.h"
 
+#include "library/common/data/payload_pool.h"
+
 const int kEnvoySuccess = ENVOY_SUCCESS;
 const int kEnvoyFailure = ENVOY_FAILURE;
 
@@ -24,6 +26,10 @@ void* safe_calloc(size_t count, size_t size) {
   return ptr;
 }
 
+void* safe_pool_malloc(size_t size) { return Envoy::Data::PayloadPool::allocate(size); }
+
+void envoy_pool_release(void* context) { Envoy::Data::PayloadPool::release(context); }
+
 void envoy_noop_release(void* context) { (void)context; }
 
 void envoy_noop_const_release(const void* context) { (void)context; }
@@ -41,6 +47,21 @@ void release_envoy_headers(envoy_headers headers) { release_envoy_data_map(heade
 
 void release_envoy_stats_tags(envoy_stats_tags stats_tags) { release_envoy_data_map(stats_tags); }
 
+void release_envoy_data_vector(envoy_data_vector data) {
+  for (envoy_data_vector_size_t i = 0; i < data.length; i++) {
+    data.segments[i].release(data.segments[i].context);
+  }
+  data.release(data.context);
+}
+
+size_t envoy_data_vector_length(envoy_data_vector data) {
+  size_t length = 0;
+  for (envoy_data_vector_size_t i = 0; i < data.length; i++) {
+    length += data.segments[i].length;
+  }
+  return length;
+}
+
 envoy_map copy_envoy_data_map(envoy_map src) {
   envoy_map_entry* dst_entries =
       static_cast<envoy_map_entry*>(safe_malloc(sizeof(envoy_map_entry) * src.length));
@@ -56,15 +77,17 @@ envoy_map copy_envoy_data_map(envoy_map src) {
 envoy_headers copy_envoy_headers(envoy_headers src) { return copy_envoy_data_map(src); }
 
 envoy_data copy_envoy_data(envoy_data src) {
-  uint8_t* dst_bytes = static_cast<uint8_t*>(safe_malloc(sizeof(uint8_t) * src.length));
+  uint8_t* dst_bytes = static_cast<uint8_t*>(safe_pool_malloc(sizeof(uint8_t) * src.length));
   memcpy(dst_bytes, src.bytes, src.length); // NOLINT(safe-memcpy)
-  // Note: since this function is copying the bytes over to freshly allocated memory, free is an
-  // appropriate release function and dst_bytes is an appropriate context.
-  return {src.length, dst_bytes, free, dst_bytes};
+  // Note: since this function is copying the bytes over to freshly pooled memory,
+  // envoy_pool_release is an appropriate release function and dst_bytes an appropriate context.
+  return {src.length, dst_bytes, envoy_pool_release, dst_bytes};
 }
 
 const envoy_data envoy_nodata = {0, NULL, envoy_noop_release, NULL};
 
+const envoy_data_vector envoy_nodata_vector = {0, NULL, envoy_noop_release, NULL};
+
 const envoy_headers envoy_noheaders = {0, NULL};
 
 const envoy_stats_tags envoy_stats_notags = {0, NULL};
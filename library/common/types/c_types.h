@@ -95,6 +95,29 @@ typedef struct {
   void* context;
 } envoy_data;
 
+/**
+ * Consistent type for dealing with envoy_data_vector segment counts.
+ */
+typedef int envoy_data_vector_size_t;
+
+/**
+ * Holds raw binary data as an ordered list of byte arrays (segments) that are not contiguous in
+ * memory. This allows multi-slice payloads to cross the bridge without being coalesced.
+ *
+ * Each segment is released individually via its own release function. Once every segment has been
+ * released, the vector's release function is invoked once with the vector's context, to dispose of
+ * the segment array and any state shared by the segments. Segments that are entirely backed by the
+ * shared state may use envoy_noop_release.
+ */
+typedef struct {
+  // Number of segments in the array.
+  envoy_data_vector_size_t length;
+  // Array of segments.
+  envoy_data* segments;
+  envoy_release_f release;
+  void* context;
+} envoy_data_vector;
+
 /**
  * Holds a single key/value pair.
  */
@@ -142,6 +165,21 @@ void* safe_malloc(size_t size);
  */
 void* safe_calloc(size_t count, size_t size);
 
+/**
+ * Allocates memory for bridged payload bytes from a thread-aware size-class pool. The memory must
+ * be released with envoy_pool_release, never free.
+ * @param size, the size of memory to be allocated in bytes.
+ * @return void*, pointer to the allocated memory.
+ */
+void* safe_pool_malloc(size_t size);
+
+/**
+ * Returns memory allocated with safe_pool_malloc to the pool. May be called from any thread.
+ * Suitable as the release function of an envoy_data whose context is the pooled memory.
+ * @param context, the memory to release.
+ */
+void envoy_pool_release(void* context);
+
 /**
  * Helper function to free/release memory associated with underlying headers.
  * @param headers, envoy_headers to release.
@@ -154,6 +192,19 @@ void release_envoy_headers(envoy_headers headers);
  */
 void release_envoy_stats_tags(envoy_stats_tags stats_tags);
 
+/**
+ * Helper function to release all segments of an envoy_data_vector, and then the vector itself.
+ * @param data, envoy_data_vector to release.
+ */
+void release_envoy_data_vector(envoy_data_vector data);
+
+/**
+ * Helper function to compute the total number of bytes held by an envoy_data_vector.
+ * @param data, the envoy_data_vector to measure.
+ * @return size_t, the sum of the lengths of all segments.
+ */
+size_t envoy_data_vector_length(envoy_data_vector data);
+
 /**
  * Helper function to copy envoy_headers.
  * @param src, the envoy_headers to copy from.
@@ -176,6 +227,9 @@ envoy_data copy_envoy_data(envoy_data src);
 // For example when sending a headers-only request.
 extern const envoy_data envoy_nodata;
 
+// Convenience constant to pass to function calls with no data segments.
+extern const envoy_data_vector envoy_nodata_vector;
+
 // Convenience constant to pass to function calls with no headers.
 extern const envoy_headers envoy_noheaders;
 
@@ -196,6 +250,21 @@ typedef struct {
   int32_t attempt_count;
 } envoy_error;
 
+/**
+ * What Envoy observed about a stream, reported with its terminal callback. Values Envoy did not
+ * observe, for instance because the stream never reached an upstream, are -1.
+ */
+typedef struct {
+  // The number of upstream requests Envoy made for the stream, including retries.
+  int64_t attempt_count;
+  // The time the upstream took to produce response headers, as measured by Envoy's router.
+  int64_t upstream_service_time_ms;
+  // The number of request body bytes the platform sent on the stream.
+  int64_t sent_byte_count;
+  // The number of response body bytes Envoy produced for the stream.
+  int64_t received_byte_count;
+} envoy_stream_intel;
+
 #ifdef __cplusplus
 extern "C" { // function pointers
 #endif
@@ -224,6 +293,20 @@ typedef void* (*envoy_on_headers_f)(envoy_headers headers, bool end_stream, void
  */
 typedef void* (*envoy_on_data_f)(envoy_data data, bool end_stream, void* context);
 
+/**
+ * Callback signature for scatter-gather data on an HTTP stream.
+ *
+ * This callback can be invoked multiple times when data is streamed. When provided, it is used in
+ * place of envoy_on_data_f, and payloads are delivered without being coalesced.
+ *
+ * @param data, the data received, as one or more segments.
+ * @param end_stream, whether the data is the last data frame.
+ * @param context, contains the necessary state to carry out platform-specific dispatch and
+ * execution.
+ * @return void*, return context (may be unused).
+ */
+typedef void* (*envoy_on_data_vector_f)(envoy_data_vector data, bool end_stream, void* context);
+
 /**
  * Callback signature for metadata on an HTTP stream.
  *
@@ -254,33 +337,79 @@ typedef void* (*envoy_on_trailers_f)(envoy_headers trailers, void* context);
  * This is a TERMINAL callback. Exactly one terminal callback will be called per stream.
  *
  * @param envoy_error, the error received/caused by the async HTTP stream.
+ * @param stream_intel, what Envoy observed about the stream.
  * @param context, contains the necessary state to carry out platform-specific dispatch and
  * execution.
  * @return void*, return context (may be unused).
  */
-typedef void* (*envoy_on_error_f)(envoy_error error, void* context);
+typedef void* (*envoy_on_error_f)(envoy_error error, envoy_stream_intel stream_intel,
+                                  void* context);
 
 /**
  * Callback signature for when an HTTP stream bi-directionally completes without error.
  *
  * This is a TERMINAL callback. Exactly one terminal callback will be called per stream.
  *
+ * @param stream_intel, what Envoy observed about the stream.
  * @param context, contains the necessary state to carry out platform-specific dispatch and
  * execution.
  * @return void*, return context (may be unused).
  */
-typedef void* (*envoy_on_complete_f)(void* context);
+typedef void* (*envoy_on_complete_f)(envoy_stream_intel stream_intel, void* context);
 
 /**
  * Callback signature for when an HTTP stream is cancelled.
  *
  * This is a TERMINAL callback. Exactly one terminal callback will be called per stream.
  *
+ * @param stream_intel, what Envoy observed about the stream.
  * @param context, contains the necessary state to carry out platform-specific dispatch and
  * execution.
  * @return void*, return context (may be unused).
  */
-typedef void* (*envoy_on_cancel_f)(void* context);
+typedef void* (*envoy_on_cancel_f)(envoy_stream_intel stream_intel, void* context);
+
+/**
+ * Callback signature for when an HTTP stream with explicit flow control is ready for more request
+ * data.
+ *
+ * This callback is invoked once after each non-final send_data call, as soon as Envoy is no longer
+ * applying backpressure to the stream's upload.
+ *
+ * @param context, contains the necessary state to carry out platform-specific dispatch and
+ * execution.
+ * @return void*, return context (may be unused).
+ */
+typedef void* (*envoy_on_send_window_available_f)(void* context);
+
+/**
+ * When a stream reached each phase of its lifetime, in microseconds since the platform's call to
+ * start it. Phases the stream did not reach are -1.
+ */
+typedef struct {
+  // Envoy's thread started the stream, after the platform's call was dispatched to it.
+  int64_t stream_start_us;
+  // Envoy produced the response headers.
+  int64_t response_headers_us;
+  // Envoy produced the first response data.
+  int64_t first_response_data_us;
+  // Envoy produced the last response data.
+  int64_t last_response_data_us;
+  // The terminal callback was dispatched.
+  int64_t terminal_us;
+} envoy_stream_timings;
+
+/**
+ * Callback signature for the breakdown of a stream's latency by phase.
+ *
+ * This callback is invoked once per stream, immediately before its terminal callback.
+ *
+ * @param timings, when the stream reached each phase.
+ * @param context, contains the necessary state to carry out platform-specific dispatch and
+ * execution.
+ * @return void*, return context (may be unused).
+ */
+typedef void* (*envoy_on_stream_timings_f)(envoy_stream_timings timings, void* context);
 
 /**
  * Called when the envoy engine is exiting.
@@ -329,8 +458,92 @@ typedef struct {
   envoy_on_cancel_f on_cancel;
   // Context passed through to callbacks to provide dispatch and execution state.
   void* context;
+  // Optional callbacks follow context, so that positional initializers written against earlier
+  // versions of this struct remain valid and leave them null. New fields must be appended here.
+  // Optional. When set, response data is delivered via on_data_vector instead of on_data.
+  envoy_on_data_vector_f on_data_vector;
+  // Optional. Paces request data on streams with explicit flow control.
+  envoy_on_send_window_available_f on_send_window_available;
+  // Optional. Reports the stream's latency breakdown.
+  envoy_on_stream_timings_f on_stream_timings;
 } envoy_http_callbacks;
 
+/**
+ * Operations that can be submitted in a batch with send_stream_operations.
+ */
+typedef enum {
+  // Equivalent to start_stream. Uses callbacks.
+  ENVOY_STREAM_OP_START,
+  // Equivalent to send_headers. Uses headers and end_stream.
+  ENVOY_STREAM_OP_HEADERS,
+  // Equivalent to send_data. Uses data and end_stream.
+  ENVOY_STREAM_OP_DATA,
+  // Equivalent to send_data_vector. Uses data_vector and end_stream.
+  ENVOY_STREAM_OP_DATA_VECTOR,
+  // Equivalent to send_trailers. Uses headers.
+  ENVOY_STREAM_OP_TRAILERS,
+  // Equivalent to reset_stream.
+  ENVOY_STREAM_OP_RESET,
+  // Equivalent to read_data. Uses bytes_to_read.
+  ENVOY_STREAM_OP_READ_DATA,
+} envoy_stream_operation_t;
+
+/**
+ * A single stream operation for submission with send_stream_operations. Ownership of the payload
+ * passes to Envoy exactly as with the equivalent single-operation function.
+ */
+typedef struct {
+  envoy_stream_operation_t type;
+  // The stream the operation applies to.
+  envoy_stream_t stream;
+  // Whether this is the last frame sent on the stream, for headers and data operations.
+  bool end_stream;
+  union {
+    envoy_http_callbacks callbacks;
+    envoy_headers headers;
+    envoy_data data;
+    envoy_data_vector data_vector;
+    size_t bytes_to_read;
+  };
+} envoy_stream_operation;
+
+/**
+ * Kinds of stream events reported through the completion ring.
+ */
+typedef enum {
+  // Response headers. Uses headers and end_stream.
+  ENVOY_STREAM_COMPLETION_HEADERS,
+  // Response data. Uses data and end_stream.
+  ENVOY_STREAM_COMPLETION_DATA,
+  // Response trailers. Uses headers.
+  ENVOY_STREAM_COMPLETION_TRAILERS,
+  // Terminal: the stream failed. Uses error.
+  ENVOY_STREAM_COMPLETION_ERROR,
+  // Terminal: the stream completed successfully.
+  ENVOY_STREAM_COMPLETION_COMPLETE,
+  // Terminal: the stream was cancelled.
+  ENVOY_STREAM_COMPLETION_CANCEL,
+} envoy_stream_completion_t;
+
+/**
+ * A single stream event harvested from the completion ring. Ownership of the payload passes to the
+ * harvester, exactly as it would to the equivalent envoy_http_callbacks callback.
+ */
+typedef struct {
+  envoy_stream_completion_t type;
+  // The stream the event belongs to.
+  envoy_stream_t stream;
+  // Whether this is the last frame received on the stream, for headers and data events.
+  bool end_stream;
+  union {
+    envoy_headers headers;
+    envoy_data data;
+    envoy_error error;
+  };
+  // What Envoy observed about the stream, for terminal events.
+  envoy_stream_intel stream_intel;
+} envoy_stream_completion;
+
 /**
  * Interface that can handle engine callbacks.
  */
@@ -27,6 +27,11 @@ public class AndroidEngineImpl implements EnvoyEngine {
     return envoyEngine.startStream(callbacks);
   }
 
+  @Override
+  public EnvoyHTTPStream startStream(EnvoyHTTPCallbacks callbacks, boolean explicitFlowControl) {
+    return envoyEngine.startStream(callbacks, explicitFlowControl);
+  }
+
   public int runWithTemplate(String configurationYAML, EnvoyConfiguration envoyConfiguration,
                              String logLevel) {
     // re-enable lifecycle-based stat flushing when https://github.com/lyft/envoy-mobile/issues/748
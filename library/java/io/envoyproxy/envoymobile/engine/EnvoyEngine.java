@@ -15,6 +15,16 @@ public interface EnvoyEngine {
    */
   EnvoyHTTPStream startStream(EnvoyHTTPCallbacks callbacks);
 
+  /**
+   * Creates a new stream with the provided callbacks.
+   *
+   * @param callbacks           The callbacks for receiving callbacks from the stream.
+   * @param explicitFlowControl Whether response data is only delivered as it is asked
+   *                            for with EnvoyHTTPStream.readData.
+   * @return A stream that may be used for sending data.
+   */
+  EnvoyHTTPStream startStream(EnvoyHTTPCallbacks callbacks, boolean explicitFlowControl);
+
   /**
    * Terminates the running engine.
    */
@@ -36,8 +36,21 @@ public class EnvoyEngineImpl implements EnvoyEngine {
    */
   @Override
   public EnvoyHTTPStream startStream(EnvoyHTTPCallbacks callbacks) {
+    return startStream(callbacks, false);
+  }
+
+  /**
+   * Creates a new stream with the provided callbacks.
+   *
+   * @param callbacks           The callbacks for the stream.
+   * @param explicitFlowControl Whether response data is only delivered as it is asked
+   *                            for with EnvoyHTTPStream.readData.
+   * @return A stream that may be used for sending data.
+   */
+  @Override
+  public EnvoyHTTPStream startStream(EnvoyHTTPCallbacks callbacks, boolean explicitFlowControl) {
     long streamHandle = JniLibrary.initStream(engineHandle);
-    EnvoyHTTPStream stream = new EnvoyHTTPStream(streamHandle, callbacks);
+    EnvoyHTTPStream stream = new EnvoyHTTPStream(streamHandle, callbacks, explicitFlowControl);
     stream.start();
     return stream;
   }
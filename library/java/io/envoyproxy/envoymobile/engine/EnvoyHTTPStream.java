@@ -11,11 +11,12 @@ import java.util.Map;
 public class EnvoyHTTPStream {
   private final long streamHandle;
   private final JvmCallbackContext callbacksContext;
+  private final boolean explicitFlowControl;
 
   /**
    * Start the stream via the JNI library.
    */
-  void start() { JniLibrary.startStream(streamHandle, callbacksContext); }
+  void start() { JniLibrary.startStream(streamHandle, callbacksContext, explicitFlowControl); }
 
   /**
    * Initialize a new stream.
@@ -23,7 +24,20 @@ public class EnvoyHTTPStream {
    * @param callbacks The callbacks for the stream.
    */
   public EnvoyHTTPStream(long streamHandle, EnvoyHTTPCallbacks callbacks) {
+    this(streamHandle, callbacks, false);
+  }
+
+  /**
+   * Initialize a new stream.
+   * @param streamHandle Underlying handle of the HTTP stream owned by an Envoy engine.
+   * @param callbacks The callbacks for the stream.
+   * @param explicitFlowControl Whether response data is only delivered as it is
+   *                            asked for with readData.
+   */
+  public EnvoyHTTPStream(long streamHandle, EnvoyHTTPCallbacks callbacks,
+                         boolean explicitFlowControl) {
     this.streamHandle = streamHandle;
+    this.explicitFlowControl = explicitFlowControl;
     callbacksContext = new JvmCallbackContext(callbacks);
   }
 
@@ -58,6 +72,25 @@ public class EnvoyHTTPStream {
     }
   }
 
+  /**
+   * Send data held in multiple buffers over an open HTTP streamHandle, without
+   * coalescing them. This method can be invoked multiple times.
+   *
+   * @param data,      the data to send.
+   * @param endStream, supplies whether this is the last data in the streamHandle.
+   * @throws UnsupportedOperationException - if any of the provided buffers is
+   *                                       neither a direct ByteBuffer nor
+   *                                       backed by an on-heap byte array.
+   */
+  public void sendData(ByteBuffer[] data, boolean endStream) {
+    for (ByteBuffer buffer : data) {
+      if (!buffer.isDirect() && !buffer.hasArray()) {
+        throw new UnsupportedOperationException("Unsupported ByteBuffer implementation.");
+      }
+    }
+    JniLibrary.sendDataVector(streamHandle, data, endStream);
+  }
+
   /**
    * Send trailers over an open HTTP streamHandle. This method can only be invoked
    * once per streamHandle. Note that this method implicitly ends the
@@ -69,6 +102,14 @@ public class EnvoyHTTPStream {
     JniLibrary.sendTrailers(streamHandle, JniBridgeUtility.toJniHeaders(trailers));
   }
 
+  /**
+   * Ask for up to byteCount bytes of response data, delivered in a single onData
+   * callback. Only applies to streams started with explicit flow control.
+   *
+   * @param byteCount, the maximum number of bytes to deliver.
+   */
+  public void readData(long byteCount) { JniLibrary.readData(streamHandle, byteCount); }
+
   /**
    * Cancel the stream. This functions as an interrupt, and aborts further
    * callbacks and handling of the stream.
@@ -59,10 +59,13 @@ public class JniLibrary {
    * @param stream,  handle to the stream to be started.
    * @param context, context that contains dispatch logic to fire callbacks
    *                 callbacks.
+   * @param explicitFlowControl, whether response data is only delivered as it
+   *                             is asked for with readData.
    * @return envoy_stream, with a stream handle and a success status, or a failure
    * status.
    */
-  protected static native int startStream(long stream, JvmCallbackContext context);
+  protected static native int startStream(long stream, JvmCallbackContext context,
+                                          boolean explicitFlowControl);
 
   /**
    * Send headers over an open HTTP stream. This method can be invoked once and
@@ -97,6 +100,17 @@ public class JniLibrary {
    */
   protected static native int sendData(long stream, ByteBuffer data, boolean endStream);
 
+  /**
+   * Send data held in multiple buffers over an open HTTP stream, without
+   * coalescing them. This method can be invoked multiple times.
+   *
+   * @param stream,    the stream to send data over.
+   * @param data,      the data to send; each buffer must be direct or array-backed.
+   * @param endStream, supplies whether this is the last data in the stream.
+   * @return int, the resulting status of the operation.
+   */
+  protected static native int sendDataVector(long stream, ByteBuffer[] data, boolean endStream);
+
   /**
    * Send trailers over an open HTTP stream. This method can only be invoked once
    * per stream. Note that this method implicitly ends the stream.
@@ -116,6 +130,17 @@ public class JniLibrary {
    */
   protected static native int resetStream(long stream);
 
+  /**
+   * Ask for response data on a stream started with explicit flow control. Up to
+   * byteCount bytes are delivered in a single onData callback, as soon as any are
+   * available.
+   *
+   * @param stream,    the stream to read from.
+   * @param byteCount, the maximum number of bytes to deliver.
+   * @return int, the resulting status of the operation.
+   */
+  protected static native int readData(long stream, long byteCount);
+
   /**
    * Register a factory for creating platform filter instances for each HTTP stream.
    *
@@ -8,6 +8,7 @@ import java.util.List;
 import java.util.Map;
 
 import io.envoyproxy.envoymobile.engine.types.EnvoyHTTPCallbacks;
+import io.envoyproxy.envoymobile.engine.types.EnvoyStreamIntel;
 
 class JvmCallbackContext {
   private final JvmBridgeUtility bridgeUtility;
@@ -116,4 +117,38 @@ class JvmCallbackContext {
 
     return null;
   }
+
+  /**
+   * Dispatches notice that more request data may be sent up to the platform
+   *
+   * @return Object, not used for response callbacks.
+   */
+  public Object onSendWindowAvailable() {
+    callbacks.getExecutor().execute(new Runnable() {
+      public void run() { callbacks.onSendWindowAvailable(); }
+    });
+
+    return null;
+  }
+
+  /**
+   * Dispatches what Envoy observed about the stream up to the platform, ahead of the
+   * terminal callback.
+   *
+   * @param attemptCount,          the number of upstream requests made, including retries.
+   * @param upstreamServiceTimeMs, the time the upstream took to produce response headers.
+   * @param sentByteCount,         the number of request body bytes sent.
+   * @param receivedByteCount,     the number of response body bytes received.
+   * @return Object,               not used for response callbacks.
+   */
+  public Object onStreamIntel(long attemptCount, long upstreamServiceTimeMs, long sentByteCount,
+                              long receivedByteCount) {
+    final EnvoyStreamIntel streamIntel = new EnvoyStreamIntel(attemptCount, upstreamServiceTimeMs,
+                                                              sentByteCount, receivedByteCount);
+    callbacks.getExecutor().execute(new Runnable() {
+      public void run() { callbacks.onStreamIntel(streamIntel); }
+    });
+
+    return null;
+  }
 }
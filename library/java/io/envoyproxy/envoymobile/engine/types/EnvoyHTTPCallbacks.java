@@ -50,4 +50,18 @@ public interface EnvoyHTTPCallbacks {
    * Called when the async HTTP stream is canceled.
    */
   void onCancel();
+
+  /**
+   * Called on streams with explicit flow control once Envoy is ready for more
+   * request data. Invoked once after each non-final sendData call.
+   */
+  void onSendWindowAvailable();
+
+  /**
+   * Called with what Envoy observed about the stream, immediately before the stream
+   * completes, fails with onError, or is canceled with onCancel.
+   *
+   * @param streamIntel, what Envoy observed about the stream.
+   */
+  void onStreamIntel(EnvoyStreamIntel streamIntel);
 }
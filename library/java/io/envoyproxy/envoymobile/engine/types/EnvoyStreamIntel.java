@@ -0,0 +1,40 @@
+package io.envoyproxy.envoymobile.engine.types;
+
+/**
+ * What Envoy observed about a stream, reported when the stream terminates. Values
+ * Envoy did not observe are -1.
+ */
+public class EnvoyStreamIntel {
+  private final long attemptCount;
+  private final long upstreamServiceTimeMs;
+  private final long sentByteCount;
+  private final long receivedByteCount;
+
+  public EnvoyStreamIntel(long attemptCount, long upstreamServiceTimeMs, long sentByteCount,
+                          long receivedByteCount) {
+    this.attemptCount = attemptCount;
+    this.upstreamServiceTimeMs = upstreamServiceTimeMs;
+    this.sentByteCount = sentByteCount;
+    this.receivedByteCount = receivedByteCount;
+  }
+
+  /**
+   * @return the number of upstream requests Envoy made for the stream, including retries.
+   */
+  public long getAttemptCount() { return attemptCount; }
+
+  /**
+   * @return the time the upstream took to produce response headers, in milliseconds.
+   */
+  public long getUpstreamServiceTimeMs() { return upstreamServiceTimeMs; }
+
+  /**
+   * @return the number of request body bytes sent on the stream.
+   */
+  public long getSentByteCount() { return sentByteCount; }
+
+  /**
+   * @return the number of response body bytes Envoy produced for the stream.
+   */
+  public long getReceivedByteCount() { return receivedByteCount; }
+}
@@ -1,6 +1,7 @@
 package io.envoyproxy.envoymobile
 
 import io.envoyproxy.envoymobile.engine.types.EnvoyHTTPCallbacks
+import io.envoyproxy.envoymobile.engine.types.EnvoyStreamIntel
 import java.nio.ByteBuffer
 import java.util.concurrent.Executor
 
@@ -16,6 +17,8 @@ internal class StreamCallbacks {
   var onTrailers: ((trailers: ResponseTrailers) -> Unit)? = null
   var onCancel: (() -> Unit)? = null
   var onError: ((error: EnvoyError) -> Unit)? = null
+  var onSendWindowAvailable: (() -> Unit)? = null
+  var onStreamIntel: ((streamIntel: EnvoyStreamIntel) -> Unit)? = null
 }
 
 /**
@@ -49,4 +52,12 @@ internal class EnvoyHTTPCallbacksAdapter(
   override fun onCancel() {
     callbacks.onCancel?.invoke()
   }
+
+  override fun onSendWindowAvailable() {
+    callbacks.onSendWindowAvailable?.invoke()
+  }
+
+  override fun onStreamIntel(streamIntel: EnvoyStreamIntel) {
+    callbacks.onStreamIntel?.invoke(streamIntel)
+  }
 }
@@ -20,6 +20,9 @@ internal class MockEnvoyEngine : EnvoyEngine {
 
   override fun startStream(callbacks: EnvoyHTTPCallbacks?): EnvoyHTTPStream = MockEnvoyHTTPStream(callbacks!!)
 
+  override fun startStream(callbacks: EnvoyHTTPCallbacks?, explicitFlowControl: Boolean): EnvoyHTTPStream =
+    MockEnvoyHTTPStream(callbacks!!)
+
   override fun terminate() = Unit
 
   override fun recordCounterInc(elements: String, tags: MutableMap<String, String>, count: Int): Int = 0
@@ -7,9 +7,9 @@ static inline envoy_data toNativeData(NSData *data) {
     return envoy_nodata;
   }
 
-  uint8_t *native_bytes = (uint8_t *)safe_malloc(sizeof(uint8_t) * data.length);
+  uint8_t *native_bytes = (uint8_t *)safe_pool_malloc(sizeof(uint8_t) * data.length);
   memcpy(native_bytes, data.bytes, data.length); // NOLINT(safe-memcpy)
-  envoy_data ret = {data.length, native_bytes, free, native_bytes};
+  envoy_data ret = {data.length, native_bytes, envoy_pool_release, native_bytes};
   return ret;
 }
 
@@ -25,9 +25,9 @@ static inline envoy_data *toNativeDataPtr(NSData *data) {
 
 static inline envoy_data toManagedNativeString(NSString *s) {
   size_t length = s.length;
-  uint8_t *native_string = (uint8_t *)safe_malloc(sizeof(uint8_t) * length);
+  uint8_t *native_string = (uint8_t *)safe_pool_malloc(sizeof(uint8_t) * length);
   memcpy(native_string, s.UTF8String, length); // NOLINT(safe-memcpy)
-  envoy_data ret = {length, native_string, free, native_string};
+  envoy_data ret = {length, native_string, envoy_pool_release, native_string};
   return ret;
 }
 
@@ -418,7 +418,7 @@ static envoy_data ios_get_string(const void *context) {
   api->static_context = CFBridgingRetain(filterFactory);
   api->instance_context = NULL;
 
-  register_platform_api(filterFactory.filterName.UTF8String, api);
+  register_engine_platform_api(_engineHandle, filterFactory.filterName.UTF8String, api);
   return kEnvoySuccess;
 }
 
@@ -429,7 +429,7 @@ static envoy_data ios_get_string(const void *context) {
   accessorStruct->get_string = ios_get_string;
   accessorStruct->context = CFBridgingRetain(accessor);
 
-  return register_platform_api(name.UTF8String, accessorStruct);
+  return register_engine_platform_api(_engineHandle, name.UTF8String, accessorStruct);
 }
 
 - (int)runWithConfig:(EnvoyConfiguration *)config logLevel:(NSString *)logLevel {
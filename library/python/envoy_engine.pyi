@@ -40,6 +40,13 @@ class EnvoyError:
     cause: Optional[Exception]
 
 
+class StreamIntel:
+    attempt_count: int
+    upstream_service_time_ms: int
+    sent_byte_count: int
+    received_byte_count: int
+
+
 class RequestHeaders:
     def __getitem__(self, name: str) -> List[str]: ...
     def all_headers(self) -> Dict[str, List[str]]: ...
@@ -136,9 +143,9 @@ class StreamPrototype:
     def set_on_headers(self, on_headers: Callable[["ResponseHeaders", bool], None]) -> "StreamPrototype": ...
     def set_on_data(self, on_data: Callable[[bytes, bool], None]) -> "StreamPrototype": ...
     def set_on_trailers(self, on_trailers: Callable[["ResponseTrailers"], None]) -> "StreamPrototype": ...
-    def set_on_error(self, on_trailers: Callable[["EnvoyError"], None]) -> "StreamPrototype": ...
-    def set_on_complete(self, on_complete: Callable[[], None]) -> "StreamPrototype": ...
-    def set_on_cancel(self, on_cancel: Callable[[], None]) -> "StreamPrototype": ...
+    def set_on_error(self, on_trailers: Callable[["EnvoyError", "StreamIntel"], None]) -> "StreamPrototype": ...
+    def set_on_complete(self, on_complete: Callable[["StreamIntel"], None]) -> "StreamPrototype": ...
+    def set_on_cancel(self, on_cancel: Callable[["StreamIntel"], None]) -> "StreamPrototype": ...
 
 
 class LogLevel:
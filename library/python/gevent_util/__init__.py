@@ -15,6 +15,7 @@ from library.python.envoy_engine import EnvoyError
 from library.python.envoy_engine import ResponseHeaders
 from library.python.envoy_engine import ResponseTrailers
 from library.python.envoy_engine import StreamClient
+from library.python.envoy_engine import StreamIntel
 from library.python.envoy_engine import StreamPrototype
 
 
@@ -84,15 +85,15 @@ class GeventStreamPrototype(CompositionalInheritor[StreamPrototype]):
         self.base.set_on_trailers(self.executor(closure))
         return self
 
-    def set_on_complete(self, closure: Callable[[], None]) -> "GeventStreamPrototype":
+    def set_on_complete(self, closure: Callable[[StreamIntel], None]) -> "GeventStreamPrototype":
         self.base.set_on_complete(self.executor(closure))
         return self
 
-    def set_on_error(self, closure: Callable[[EnvoyError], None]) -> "GeventStreamPrototype":
+    def set_on_error(self, closure: Callable[[EnvoyError, StreamIntel], None]) -> "GeventStreamPrototype":
         self.base.set_on_error(self.executor(closure))
         return self
 
-    def set_on_cancel(self, closure: Callable[[], None]) -> "GeventStreamPrototype":
+    def set_on_cancel(self, closure: Callable[[StreamIntel], None]) -> "GeventStreamPrototype":
         self.base.set_on_cancel(self.executor(closure))
         return self
 
@@ -28,6 +28,7 @@
 #include "library/cc/stream.h"
 #include "library/cc/stream_callbacks.h"
 #include "library/cc/stream_client.h"
+#include "library/cc/stream_intel.h"
 #include "library/cc/stream_prototype.h"
 #include "library/cc/upstream_http_protocol.h"
 
@@ -71,6 +72,12 @@ PYBIND11_MODULE(envoy_engine, m) {
       .def_readwrite("attempt_count", &EnvoyError::attempt_count)
       .def_readwrite("cause", &EnvoyError::cause);
 
+  py::class_<StreamIntel, StreamIntelSharedPtr>(m, "StreamIntel")
+      .def_readwrite("attempt_count", &StreamIntel::attempt_count)
+      .def_readwrite("upstream_service_time_ms", &StreamIntel::upstream_service_time_ms)
+      .def_readwrite("sent_byte_count", &StreamIntel::sent_byte_count)
+      .def_readwrite("received_byte_count", &StreamIntel::received_byte_count);
+
   py::enum_<LogLevel>(m, "LogLevel")
       .value("Trace", LogLevel::trace)
       .value("Debug", LogLevel::debug)
@@ -72,12 +72,14 @@ TEST(TestSendHeaders, CanSendHeaders) {
     status.status_code = headers->httpStatus();
     status.end_stream = end_stream;
   });
-  stream_prototype->setOnComplete([&]() { stream_complete.Notify(); });
-  stream_prototype->setOnError([&](Platform::EnvoyErrorSharedPtr envoy_error) {
-    (void)envoy_error;
-    stream_complete.Notify();
-  });
-  stream_prototype->setOnCancel([&]() { stream_complete.Notify(); });
+  stream_prototype->setOnComplete(
+      [&](Platform::StreamIntelSharedPtr) { stream_complete.Notify(); });
+  stream_prototype->setOnError(
+      [&](Platform::EnvoyErrorSharedPtr envoy_error, Platform::StreamIntelSharedPtr) {
+        (void)envoy_error;
+        stream_complete.Notify();
+      });
+  stream_prototype->setOnCancel([&](Platform::StreamIntelSharedPtr) { stream_complete.Notify(); });
 
   stream = stream_prototype->start();
 
@@ -95,5 +97,47 @@ TEST(TestSendHeaders, CanSendHeaders) {
   engine->terminate();
 }
 
+TEST(TestSendHeaders, PendingBatchFlushedOnDestruction) {
+  Platform::EngineSharedPtr engine;
+  absl::Notification engine_running;
+  auto engine_builder = Platform::EngineBuilder(CONFIG_TEMPLATE);
+  engine = engine_builder.addLogLevel(Platform::LogLevel::debug)
+               .setOnEngineRunning([&]() { engine_running.Notify(); })
+               .build();
+  engine_running.WaitForNotification();
+
+  Status status;
+  absl::Notification stream_complete;
+  auto stream_prototype = engine->streamClient()->newStreamPrototype();
+
+  stream_prototype->setOnHeaders([&](Platform::ResponseHeadersSharedPtr headers, bool end_stream) {
+    status.status_code = headers->httpStatus();
+    status.end_stream = end_stream;
+  });
+  stream_prototype->setOnComplete(
+      [&](Platform::StreamIntelSharedPtr) { stream_complete.Notify(); });
+  stream_prototype->setOnError(
+      [&](Platform::EnvoyErrorSharedPtr, Platform::StreamIntelSharedPtr) {
+        stream_complete.Notify();
+      });
+  stream_prototype->setOnCancel([&](Platform::StreamIntelSharedPtr) { stream_complete.Notify(); });
+
+  Platform::RequestHeadersBuilder request_headers_builder(Platform::RequestMethod::GET, "https",
+                                                          "example.com", "/");
+  auto request_headers = request_headers_builder.build();
+  auto request_headers_ptr =
+      Platform::RequestHeadersSharedPtr(new Platform::RequestHeaders(request_headers));
+
+  // The headers are still held by the batch when the stream goes away, and must reach Envoy
+  // rather than leak.
+  stream_prototype->start()->startBatch().sendHeaders(request_headers_ptr, true);
+  stream_complete.WaitForNotification();
+
+  EXPECT_EQ(status.status_code, 200);
+  EXPECT_EQ(status.end_stream, true);
+
+  engine->terminate();
+}
+
 } // namespace
 } // namespace Envoy
@@ -35,5 +35,28 @@ TEST(BridgeFragmentTest, Basic) {
   delete sentinel;
 }
 
+TEST(BridgeFragmentTest, RecyclesFragments) {
+  uint32_t* sentinel = new uint32_t;
+  *sentinel = 0;
+  std::string s = "test string";
+
+  const BridgeFragmentAllocationStats before = BridgeFragmentFactory::stats();
+  BridgeFragment* first = BridgeFragment::createBridgeFragment(toTestEnvoyData(s, sentinel));
+  first->done();
+  ASSERT_EQ(*sentinel, 1);
+
+  // The next fragment on this thread reuses the storage of the first.
+  BridgeFragment* second = BridgeFragment::createBridgeFragment(toTestEnvoyData(s, sentinel));
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(second->size(), s.size());
+  second->done();
+  ASSERT_EQ(*sentinel, 2);
+
+  const BridgeFragmentAllocationStats after = BridgeFragmentFactory::stats();
+  EXPECT_EQ(after.pooled_ + after.fresh_, before.pooled_ + before.fresh_ + 2);
+  EXPECT_GE(after.pooled_, before.pooled_ + 1);
+  delete sentinel;
+}
+
 } // namespace Buffer
 } // namespace Envoy
@@ -0,0 +1,40 @@
+#include "gtest/gtest.h"
+#include "library/common/common/block_pool.h"
+
+namespace Envoy {
+
+TEST(BlockPoolTest, ReusesReleasedBlocks) {
+  BlockPool pool(64, 2);
+  void* first = pool.allocate(64);
+  pool.release(first, 64);
+  EXPECT_EQ(1, pool.freeBlocks());
+
+  EXPECT_EQ(first, pool.allocate(64));
+  EXPECT_EQ(0, pool.freeBlocks());
+  EXPECT_EQ(1, pool.reused());
+  pool.release(first, 64);
+}
+
+TEST(BlockPoolTest, RetainsUpToLimit) {
+  BlockPool pool(64, 2);
+  void* blocks[3] = {pool.allocate(64), pool.allocate(64), pool.allocate(64)};
+  for (void* block : blocks) {
+    pool.release(block, 64);
+  }
+  EXPECT_EQ(2, pool.freeBlocks());
+  EXPECT_EQ(0, pool.reused());
+}
+
+TEST(BlockPoolTest, OtherSizesBypassPool) {
+  BlockPool pool(64, 2);
+  void* block = pool.allocate(128);
+  pool.release(block, 128);
+  EXPECT_EQ(0, pool.freeBlocks());
+
+  pool.release(pool.allocate(64), 64);
+  pool.release(pool.allocate(32), 32);
+  EXPECT_EQ(1, pool.freeBlocks());
+  EXPECT_EQ(0, pool.reused());
+}
+
+} // namespace Envoy
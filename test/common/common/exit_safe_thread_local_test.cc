@@ -0,0 +1,53 @@
+#include <atomic>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "library/common/common/exit_safe_thread_local.h"
+
+namespace Envoy {
+namespace {
+
+struct Counter {
+  int value_{};
+};
+
+TEST(ExitSafeThreadLocalTest, OneInstancePerThread) {
+  Counter* main_counter = ExitSafeThreadLocal<Counter>::get();
+  ASSERT_NE(nullptr, main_counter);
+  main_counter->value_ = 1;
+  EXPECT_EQ(main_counter, ExitSafeThreadLocal<Counter>::get());
+
+  Counter* other_counter = nullptr;
+  std::thread([&other_counter]() {
+    other_counter = ExitSafeThreadLocal<Counter>::get();
+    EXPECT_EQ(0, other_counter->value_);
+  }).join();
+  EXPECT_NE(main_counter, other_counter);
+  EXPECT_EQ(1, main_counter->value_);
+}
+
+struct Tracked {
+  ~Tracked() { destroyed_ = true; }
+
+  static inline std::atomic<bool> destroyed_{false};
+};
+
+// Constructed before the Tracked instance on its thread, so it is destroyed after it.
+struct LateObserver {
+  ~LateObserver() { saw_nullptr_ = ExitSafeThreadLocal<Tracked>::get() == nullptr; }
+
+  static inline std::atomic<bool> saw_nullptr_{false};
+};
+
+TEST(ExitSafeThreadLocalTest, NullAfterDestructionDuringThreadExit) {
+  std::thread([]() {
+    static thread_local LateObserver observer;
+    (void)observer;
+    ASSERT_NE(nullptr, ExitSafeThreadLocal<Tracked>::get());
+  }).join();
+  EXPECT_TRUE(Tracked::destroyed_);
+  EXPECT_TRUE(LateObserver::saw_nullptr_);
+}
+
+} // namespace
+} // namespace Envoy
@@ -0,0 +1,71 @@
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "absl/container/flat_hash_set.h"
+#include "gtest/gtest.h"
+#include "library/common/data/payload_pool.h"
+#include "library/common/types/c_types.h"
+
+namespace Envoy {
+namespace Data {
+
+TEST(PayloadPoolTest, ReusesReleasedBlocks) {
+  void* first = PayloadPool::allocate(100);
+  PayloadPool::release(first);
+  // Any size in the same size class is served from the calling thread's cache.
+  void* second = PayloadPool::allocate(120);
+  EXPECT_EQ(first, second);
+  PayloadPool::release(second);
+}
+
+TEST(PayloadPoolTest, BuffersAreUsable) {
+  for (size_t size : {0, 1, 64, 65, 4096, 16384, 16385, 1 << 20}) {
+    uint8_t* buffer = static_cast<uint8_t*>(PayloadPool::allocate(size));
+    ASSERT_NE(buffer, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(buffer) % alignof(std::max_align_t), 0);
+    memset(buffer, 'a', size);
+    PayloadPool::release(buffer);
+  }
+  PayloadPool::release(nullptr);
+}
+
+TEST(PayloadPoolTest, ReleaseOnAnotherThread) {
+  std::vector<void*> buffers;
+  for (size_t i = 0; i < 100; i++) {
+    buffers.push_back(PayloadPool::allocate(1000));
+  }
+  std::thread releaser([&buffers]() {
+    for (void* buffer : buffers) {
+      PayloadPool::release(buffer);
+    }
+  });
+  releaser.join();
+
+  // Blocks released by the exited thread have been returned to the shared depot. Allocating more
+  // than this thread can cache drains its own cache and then hands those blocks out again.
+  const absl::flat_hash_set<void*> released(buffers.begin(), buffers.end());
+  std::vector<void*> reused;
+  bool found_released = false;
+  for (size_t i = 0; i < 200; i++) {
+    reused.push_back(PayloadPool::allocate(1000));
+    found_released |= released.contains(reused.back());
+  }
+  EXPECT_TRUE(found_released);
+  for (void* buffer : reused) {
+    PayloadPool::release(buffer);
+  }
+}
+
+TEST(PayloadPoolTest, BridgeData) {
+  envoy_data original = {5, reinterpret_cast<const uint8_t*>("hello"), envoy_noop_release,
+                         nullptr};
+  envoy_data copy = copy_envoy_data(original);
+  EXPECT_EQ(copy.release, envoy_pool_release);
+  EXPECT_NE(copy.bytes, original.bytes);
+  EXPECT_EQ(memcmp(copy.bytes, "hello", 5), 0);
+  copy.release(copy.context);
+}
+
+} // namespace Data
+} // namespace Envoy
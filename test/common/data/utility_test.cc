@@ -26,6 +26,65 @@ TEST(DataConstructorTest, FromCToCpp) {
   ASSERT_EQ(cpp_data->toString(), s);
 }
 
+void envoy_test_release(void* context) {
+  uint32_t* counter = static_cast<uint32_t*>(context);
+  *counter = *counter + 1;
+}
+
+TEST(DataConstructorTest, FromCVectorToCpp) {
+  std::string s1 = "test ";
+  std::string s2 = "string";
+  uint32_t segment_releases = 0;
+  uint32_t vector_releases = 0;
+  envoy_data segments[] = {
+      {s1.size(), reinterpret_cast<const uint8_t*>(s1.c_str()), envoy_test_release,
+       &segment_releases},
+      {s2.size(), reinterpret_cast<const uint8_t*>(s2.c_str()), envoy_test_release,
+       &segment_releases},
+  };
+  envoy_data_vector c_data = {2, segments, envoy_test_release, &vector_releases};
+
+  Buffer::InstancePtr cpp_data = Utility::toInternalData(c_data);
+
+  ASSERT_EQ(cpp_data->length(), s1.size() + s2.size());
+  ASSERT_EQ(cpp_data->getRawSlices().size(), 2);
+  ASSERT_EQ(cpp_data->toString(), s1 + s2);
+
+  cpp_data->drain(s1.size());
+  ASSERT_EQ(segment_releases, 1);
+  ASSERT_EQ(vector_releases, 0);
+  cpp_data->drain(s2.size());
+  ASSERT_EQ(segment_releases, 2);
+  ASSERT_EQ(vector_releases, 1);
+}
+
+TEST(DataConstructorTest, FromCVectorToCppEmpty) {
+  uint32_t vector_releases = 0;
+  envoy_data_vector c_data = {0, nullptr, envoy_test_release, &vector_releases};
+
+  Buffer::InstancePtr cpp_data = Utility::toInternalData(c_data);
+
+  ASSERT_EQ(cpp_data->length(), 0);
+  ASSERT_EQ(vector_releases, 1);
+}
+
+TEST(DataConstructorTest, FromCppToCVector) {
+  std::string s1 = "test ";
+  std::string s2 = "string";
+  Buffer::OwnedImpl cpp_data;
+  cpp_data.appendSliceForTest(s1);
+  cpp_data.appendSliceForTest(s2);
+
+  envoy_data_vector c_data = Utility::toBridgeDataVector(cpp_data);
+
+  ASSERT_EQ(cpp_data.length(), 0);
+  ASSERT_EQ(c_data.length, 2);
+  ASSERT_EQ(envoy_data_vector_length(c_data), s1.size() + s2.size());
+  ASSERT_EQ(Utility::copyToString(c_data.segments[0]), s1);
+  ASSERT_EQ(Utility::copyToString(c_data.segments[1]), s2);
+  release_envoy_data_vector(c_data);
+}
+
 TEST(DataConstructorTest, FromCppToCEmpty) {
   Buffer::OwnedImpl empty_data;
 
@@ -46,6 +105,35 @@ TEST(DataConstructorTest, FromCppToC) {
   c_data.release(c_data.context);
 }
 
+TEST(DataConstructorTest, FromCppToCSingleSliceIsNotCopied) {
+  std::string s = "test string";
+  Buffer::OwnedImpl cpp_data = Buffer::OwnedImpl(absl::string_view(s));
+  const void* slice_start = cpp_data.getRawSlices()[0].mem_;
+
+  envoy_data c_data = Utility::toBridgeData(cpp_data);
+
+  ASSERT_EQ(cpp_data.length(), 0);
+  ASSERT_EQ(c_data.bytes, slice_start);
+  ASSERT_EQ(Utility::copyToString(c_data), s);
+  c_data.release(c_data.context);
+}
+
+TEST(DataConstructorTest, FromCppToCMultipleSlices) {
+  std::string s1 = "test string";
+  std::string s2 = "another test string";
+  Buffer::OwnedImpl cpp_data;
+  cpp_data.appendSliceForTest(s1);
+  cpp_data.appendSliceForTest(s2);
+  ASSERT_EQ(cpp_data.getRawSlices().size(), 2);
+
+  envoy_data c_data = Utility::toBridgeData(cpp_data);
+
+  ASSERT_EQ(cpp_data.length(), 0);
+  ASSERT_EQ(c_data.length, s1.size() + s2.size());
+  ASSERT_EQ(Utility::copyToString(c_data), s1 + s2);
+  c_data.release(c_data.context);
+}
+
 TEST(DataConstructorTest, CopyFromCppToC) {
   std::string s = "test string";
   Buffer::OwnedImpl cpp_data = Buffer::OwnedImpl(absl::string_view(s));
@@ -0,0 +1,88 @@
+#include <chrono>
+#include <vector>
+
+#include "test/common/stats/stat_test_utility.h"
+#include "test/test_common/simulated_time_system.h"
+#include "test/test_common/utility.h"
+
+#include "gtest/gtest.h"
+#include "library/common/event/loop_lag_monitor.h"
+
+namespace Envoy {
+namespace Event {
+
+class LoopLagMonitorTest : public testing::Test {
+public:
+  LoopLagMonitorTest()
+      : api_(Api::createApiForTest(time_system_)),
+        dispatcher_(api_->allocateDispatcher("test_thread")) {}
+
+  std::vector<uint64_t> lagValues() {
+    return store_.histogramValues("dispatcher.loop_lag_us", false);
+  }
+
+  // Runs a callback attributed to name that takes the given time.
+  void runCallback(absl::string_view name, std::chrono::milliseconds duration) {
+    LoopLagMonitor::ScopedCallback tracked("platform_filter", name);
+    time_system_.advanceTimeAsync(duration);
+  }
+
+  Event::SimulatedTimeSystem time_system_;
+  Stats::TestUtil::TestStore store_;
+  Api::ApiPtr api_;
+  DispatcherPtr dispatcher_;
+};
+
+TEST_F(LoopLagMonitorTest, RecordsLag) {
+  LoopLagMonitor monitor(*dispatcher_, store_, std::chrono::milliseconds(500), 0);
+
+  // The loop gets to the timer 200ms after it was due.
+  time_system_.advanceTimeAndRun(std::chrono::milliseconds(700), *dispatcher_,
+                                 Dispatcher::RunType::NonBlock);
+  EXPECT_EQ(lagValues(), std::vector<uint64_t>({200000}));
+
+  // Sampling continues from when the timer ran.
+  time_system_.advanceTimeAndRun(std::chrono::milliseconds(500), *dispatcher_,
+                                 Dispatcher::RunType::NonBlock);
+  EXPECT_EQ(lagValues(), std::vector<uint64_t>({200000, 0}));
+}
+
+TEST_F(LoopLagMonitorTest, KeepsSlowestCallbacks) {
+  LoopLagMonitor monitor(*dispatcher_, store_, std::chrono::milliseconds(500), 2);
+
+  runCallback("fast", std::chrono::milliseconds(1));
+  runCallback("slowest", std::chrono::milliseconds(5));
+  runCallback("slow", std::chrono::milliseconds(3));
+  {
+    LoopLagMonitor::ScopedCallback tracked("stats_flush");
+    time_system_.advanceTimeAsync(std::chrono::milliseconds(2));
+  }
+
+  const auto& slowest = monitor.slowestCallbacks();
+  ASSERT_EQ(2, slowest.size());
+  EXPECT_EQ("platform_filter:slowest", slowest[0].origin_);
+  EXPECT_EQ(std::chrono::milliseconds(5), slowest[0].duration_);
+  EXPECT_EQ("platform_filter:slow", slowest[1].origin_);
+  EXPECT_EQ(std::chrono::milliseconds(3), slowest[1].duration_);
+
+  // Every tracked callback is also recorded under its origin, whether or not it was kept.
+  EXPECT_EQ(std::vector<uint64_t>({1000}),
+            store_.histogramValues("dispatcher.callback.platform_filter.fast.duration_us", false));
+  EXPECT_EQ(std::vector<uint64_t>({5000}),
+            store_.histogramValues("dispatcher.callback.platform_filter.slowest.duration_us",
+                                   false));
+  EXPECT_EQ(std::vector<uint64_t>({2000}),
+            store_.histogramValues("dispatcher.callback.stats_flush.duration_us", false));
+}
+
+TEST_F(LoopLagMonitorTest, CallbacksIgnoredWithoutTracking) {
+  // No monitor on this thread.
+  runCallback("unmonitored", std::chrono::milliseconds(1));
+
+  LoopLagMonitor monitor(*dispatcher_, store_, std::chrono::milliseconds(500), 0);
+  runCallback("untracked", std::chrono::milliseconds(1));
+  EXPECT_TRUE(monitor.slowestCallbacks().empty());
+}
+
+} // namespace Event
+} // namespace Envoy
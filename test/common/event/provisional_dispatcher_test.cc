@@ -0,0 +1,64 @@
+#include <string>
+#include <vector>
+
+#include "test/common/stats/stat_test_utility.h"
+#include "test/test_common/utility.h"
+
+#include "gtest/gtest.h"
+#include "library/common/event/provisional_dispatcher.h"
+
+namespace Envoy {
+namespace Event {
+
+class ProvisionalDispatcherTest : public testing::Test {
+public:
+  ProvisionalDispatcherTest()
+      : api_(Api::createApiForTest()), event_dispatcher_(api_->allocateDispatcher("test_thread")) {
+    dispatcher_.initializeStats(store_);
+  }
+
+  uint64_t gaugeValue(const std::string& name) {
+    return TestUtility::findGauge(store_, name)->value();
+  }
+
+  Stats::TestUtil::TestStore store_;
+  Api::ApiPtr api_;
+  DispatcherPtr event_dispatcher_;
+  ProvisionalDispatcher dispatcher_;
+  std::vector<int> ran_;
+};
+
+TEST_F(ProvisionalDispatcherTest, PostsQueuedBeforeDrainAreMeasured) {
+  for (int i = 0; i < 3; i++) {
+    dispatcher_.post([this, i]() -> void { ran_.push_back(i); });
+  }
+  EXPECT_TRUE(ran_.empty());
+
+  dispatcher_.drain(*event_dispatcher_);
+  event_dispatcher_->run(Dispatcher::RunType::NonBlock);
+
+  EXPECT_EQ(ran_, std::vector<int>({0, 1, 2}));
+  EXPECT_EQ(3, store_.histogramValues("dispatcher.post_latency_us", false).size());
+  EXPECT_EQ(0, gaugeValue("dispatcher.queue_depth"));
+  EXPECT_EQ(3, gaugeValue("dispatcher.max_queue_depth"));
+}
+
+TEST_F(ProvisionalDispatcherTest, MaxDepthCoversEachSnapshot) {
+  dispatcher_.drain(*event_dispatcher_);
+  dispatcher_.post([this]() -> void { ran_.push_back(0); });
+  dispatcher_.post([this]() -> void { ran_.push_back(1); });
+  event_dispatcher_->run(Dispatcher::RunType::NonBlock);
+  EXPECT_EQ(2, gaugeValue("dispatcher.max_queue_depth"));
+
+  // The next snapshot reports only the peak since the previous one.
+  dispatcher_.post([this]() -> void { ran_.push_back(2); });
+  event_dispatcher_->run(Dispatcher::RunType::NonBlock);
+
+  EXPECT_EQ(ran_, std::vector<int>({0, 1, 2}));
+  EXPECT_EQ(3, store_.histogramValues("dispatcher.post_latency_us", false).size());
+  EXPECT_EQ(0, gaugeValue("dispatcher.queue_depth"));
+  EXPECT_EQ(1, gaugeValue("dispatcher.max_queue_depth"));
+}
+
+} // namespace Event
+} // namespace Envoy
@@ -1,17 +1,20 @@
 #include <atomic>
+#include <string>
+#include <vector>
 
 #include "common/buffer/buffer_impl.h"
 #include "common/http/context_impl.h"
-#include "common/stats/isolated_store_impl.h"
 
 #include "test/common/http/common.h"
 #include "test/common/mocks/event/mocks.h"
+#include "test/common/stats/stat_test_utility.h"
 #include "test/mocks/buffer/mocks.h"
 #include "test/mocks/event/mocks.h"
 #include "test/mocks/http/api_listener.h"
 #include "test/mocks/http/mocks.h"
 #include "test/mocks/local_info/mocks.h"
 #include "test/mocks/upstream/mocks.h"
+#include "test/test_common/simulated_time_system.h"
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -60,14 +63,15 @@ public:
   NiceMock<Event::MockProvisionalDispatcher> dispatcher_;
   envoy_http_callbacks bridge_callbacks_;
   std::atomic<envoy_network_t> preferred_network_{ENVOY_NET_GENERIC};
-  Stats::IsolatedStoreImpl stats_store_;
-  Client http_client_{api_listener_, dispatcher_, stats_store_, preferred_network_};
+  Stats::TestUtil::TestStore stats_store_;
+  Event::SimulatedTimeSystem time_system_;
+  Client http_client_{api_listener_, dispatcher_, stats_store_, preferred_network_, time_system_};
 };
 
 TEST_F(ClientTest, SetDestinationCluster) {
   envoy_stream_t stream = 1;
   // Setup bridge_callbacks to handle the response headers.
-  envoy_http_callbacks bridge_callbacks;
+  envoy_http_callbacks bridge_callbacks{};
   callbacks_called cc = {0, 0, 0, 0, 0, 0};
   bridge_callbacks.context = &cc;
   bridge_callbacks.on_headers = [](envoy_headers c_headers, bool end_stream,
@@ -79,7 +83,7 @@ TEST_F(ClientTest, SetDestinationCluster) {
     cc->on_headers_calls++;
     return nullptr;
   };
-  bridge_callbacks.on_complete = [](void* context) -> void* {
+  bridge_callbacks.on_complete = [](envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_complete_calls++;
     return nullptr;
@@ -168,7 +172,7 @@ TEST_F(ClientTest, SetDestinationCluster) {
 TEST_F(ClientTest, SetDestinationClusterUpstreamProtocol) {
   envoy_stream_t stream = 1;
   // Setup bridge_callbacks to handle the response headers.
-  envoy_http_callbacks bridge_callbacks;
+  envoy_http_callbacks bridge_callbacks{};
   callbacks_called cc = {0, 0, 0, 0, 0, 0};
   bridge_callbacks.context = &cc;
   bridge_callbacks.on_headers = [](envoy_headers c_headers, bool end_stream,
@@ -180,7 +184,7 @@ TEST_F(ClientTest, SetDestinationClusterUpstreamProtocol) {
     cc->on_headers_calls++;
     return nullptr;
   };
-  bridge_callbacks.on_complete = [](void* context) -> void* {
+  bridge_callbacks.on_complete = [](envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_complete_calls++;
     return nullptr;
@@ -288,7 +292,7 @@ TEST_F(ClientTest, SetDestinationClusterUpstreamProtocol) {
 TEST_F(ClientTest, BasicStreamHeaders) {
   envoy_stream_t stream = 1;
   // Setup bridge_callbacks to handle the response headers.
-  envoy_http_callbacks bridge_callbacks;
+  envoy_http_callbacks bridge_callbacks{};
   callbacks_called cc = {0, 0, 0, 0, 0, 0};
   bridge_callbacks.context = &cc;
   bridge_callbacks.on_headers = [](envoy_headers c_headers, bool end_stream,
@@ -300,7 +304,7 @@ TEST_F(ClientTest, BasicStreamHeaders) {
     cc->on_headers_calls++;
     return nullptr;
   };
-  bridge_callbacks.on_complete = [](void* context) -> void* {
+  bridge_callbacks.on_complete = [](envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_complete_calls++;
     return nullptr;
@@ -341,7 +345,7 @@ TEST_F(ClientTest, BasicStreamHeaders) {
 TEST_F(ClientTest, BasicStreamData) {
   envoy_stream_t stream = 1;
   // Setup bridge_callbacks to handle the response.
-  envoy_http_callbacks bridge_callbacks;
+  envoy_http_callbacks bridge_callbacks{};
   callbacks_called cc = {0, 0, 0, 0, 0, 0};
   bridge_callbacks.context = &cc;
   bridge_callbacks.on_data = [](envoy_data c_data, bool end_stream, void* context) -> void* {
@@ -352,7 +356,7 @@ TEST_F(ClientTest, BasicStreamData) {
     c_data.release(c_data.context);
     return nullptr;
   };
-  bridge_callbacks.on_complete = [](void* context) -> void* {
+  bridge_callbacks.on_complete = [](envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_complete_calls++;
     return nullptr;
@@ -390,10 +394,121 @@ TEST_F(ClientTest, BasicStreamData) {
   ASSERT_EQ(cc.on_complete_calls, 1);
 }
 
+TEST_F(ClientTest, BasicStreamDataVector) {
+  envoy_stream_t stream = 1;
+  // Setup bridge_callbacks to handle the response.
+  envoy_http_callbacks bridge_callbacks{};
+  callbacks_called cc = {0, 0, 0, 0, 0, 0};
+  bridge_callbacks.context = &cc;
+  bridge_callbacks.on_data_vector = [](envoy_data_vector c_data, bool end_stream,
+                                       void* context) -> void* {
+    EXPECT_TRUE(end_stream);
+    EXPECT_EQ(c_data.length, 2);
+    EXPECT_EQ(Data::Utility::copyToString(c_data.segments[0]), "response ");
+    EXPECT_EQ(Data::Utility::copyToString(c_data.segments[1]), "body");
+    callbacks_called* cc = static_cast<callbacks_called*>(context);
+    cc->on_data_calls++;
+    release_envoy_data_vector(c_data);
+    return nullptr;
+  };
+  bridge_callbacks.on_complete = [](envoy_stream_intel, void* context) -> void* {
+    callbacks_called* cc = static_cast<callbacks_called*>(context);
+    cc->on_complete_calls++;
+    return nullptr;
+  };
+
+  // Build body data out of two slices.
+  Buffer::OwnedImpl request_data;
+  request_data.appendSliceForTest("request ");
+  request_data.appendSliceForTest("body");
+  envoy_data_vector c_data = Data::Utility::toBridgeDataVector(request_data);
+  ASSERT_EQ(c_data.length, 2);
+
+  // Create a stream.
+  ON_CALL(dispatcher_, isThreadSafe()).WillByDefault(Return(true));
+
+  // Grab the response encoder in order to dispatch responses on the stream.
+  // Return the request decoder to make sure calls are dispatched to the decoder via the
+  // dispatcher API.
+  EXPECT_CALL(api_listener_, newStream(_, _))
+      .WillOnce(Invoke([&](ResponseEncoder& encoder, bool) -> RequestDecoder& {
+        response_encoder_ = &encoder;
+        return request_decoder_;
+      }));
+  EXPECT_EQ(http_client_.startStream(stream, bridge_callbacks), ENVOY_SUCCESS);
+
+  // Send request data. Although HTTP would need headers before data this unit test only wants to
+  // test data functionality.
+  EXPECT_CALL(request_decoder_, decodeData(BufferStringEqual("request body"), true));
+  http_client_.sendDataVector(stream, c_data, true);
+
+  // Encode response data.
+  EXPECT_CALL(dispatcher_, deferredDelete_(_));
+  Buffer::OwnedImpl response_data;
+  response_data.appendSliceForTest("response ");
+  response_data.appendSliceForTest("body");
+  response_encoder_->encodeData(response_data, true);
+  ASSERT_EQ(cc.on_data_calls, 1);
+  // Ensure that the callbacks on the bridge_callbacks were called.
+  ASSERT_EQ(cc.on_complete_calls, 1);
+}
+
+TEST_F(ClientTest, BatchedStreamOperations) {
+  envoy_http_callbacks bridge_callbacks{};
+  callbacks_called cc = {0, 0, 0, 0, 0, 0};
+  bridge_callbacks.context = &cc;
+  bridge_callbacks.on_cancel = [](envoy_stream_intel, void* context) -> void* {
+    callbacks_called* cc = static_cast<callbacks_called*>(context);
+    cc->on_cancel_calls++;
+    return nullptr;
+  };
+
+  TestRequestHeaderMapImpl headers;
+  HttpTestUtility::addDefaultHeaders(headers);
+  Buffer::OwnedImpl request_data = Buffer::OwnedImpl("request body");
+
+  // Start one stream and send a full request on it, then start and reset a second, all in one
+  // batch.
+  std::vector<envoy_stream_operation> operations(5);
+  operations[0].type = ENVOY_STREAM_OP_START;
+  operations[0].stream = 1;
+  operations[0].callbacks = bridge_callbacks;
+  operations[1].type = ENVOY_STREAM_OP_HEADERS;
+  operations[1].stream = 1;
+  operations[1].headers = Utility::toBridgeHeaders(headers);
+  operations[2].type = ENVOY_STREAM_OP_DATA;
+  operations[2].stream = 1;
+  operations[2].data = Data::Utility::toBridgeData(request_data);
+  operations[2].end_stream = true;
+  operations[3].type = ENVOY_STREAM_OP_START;
+  operations[3].stream = 2;
+  operations[3].callbacks = bridge_callbacks;
+  operations[4].type = ENVOY_STREAM_OP_RESET;
+  operations[4].stream = 2;
+
+  ON_CALL(dispatcher_, isThreadSafe()).WillByDefault(Return(true));
+  MockRequestDecoder request_decoder_2;
+  EXPECT_CALL(api_listener_, newStream(_, _))
+      .WillOnce(Invoke([&](ResponseEncoder& encoder, bool) -> RequestDecoder& {
+        response_encoder_ = &encoder;
+        return request_decoder_;
+      }))
+      .WillOnce(ReturnRef(request_decoder_2));
+  {
+    testing::InSequence s;
+    EXPECT_CALL(request_decoder_, decodeHeaders_(_, false));
+    EXPECT_CALL(request_decoder_, decodeData(BufferStringEqual("request body"), true));
+  }
+  EXPECT_CALL(dispatcher_, deferredDelete_(_));
+
+  http_client_.applyStreamOperations(operations.data(), operations.size());
+  ASSERT_EQ(cc.on_cancel_calls, 1);
+}
+
 TEST_F(ClientTest, BasicStreamTrailers) {
   envoy_stream_t stream = 1;
   // Setup bridge_callbacks to handle the response.
-  envoy_http_callbacks bridge_callbacks;
+  envoy_http_callbacks bridge_callbacks{};
   callbacks_called cc = {0, 0, 0, 0, 0, 0};
   bridge_callbacks.context = &cc;
   bridge_callbacks.on_trailers = [](envoy_headers c_trailers, void* context) -> void* {
@@ -404,7 +519,7 @@ TEST_F(ClientTest, BasicStreamTrailers) {
     cc->on_trailers_calls++;
     return nullptr;
   };
-  bridge_callbacks.on_complete = [](void* context) -> void* {
+  bridge_callbacks.on_complete = [](envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_complete_calls++;
     return nullptr;
@@ -445,7 +560,7 @@ TEST_F(ClientTest, BasicStreamTrailers) {
 TEST_F(ClientTest, MultipleDataStream) {
   envoy_stream_t stream = 1;
   // Setup bridge_callbacks to handle the response.
-  envoy_http_callbacks bridge_callbacks;
+  envoy_http_callbacks bridge_callbacks{};
   callbacks_called cc = {0, 0, 0, 0, 0, 0};
   bridge_callbacks.context = &cc;
   bridge_callbacks.on_headers = [](envoy_headers c_headers, bool end_stream,
@@ -464,7 +579,7 @@ TEST_F(ClientTest, MultipleDataStream) {
     data.release(data.context);
     return nullptr;
   };
-  bridge_callbacks.on_complete = [](void* context) -> void* {
+  bridge_callbacks.on_complete = [](envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_complete_calls++;
     return nullptr;
@@ -532,7 +647,7 @@ TEST_F(ClientTest, MultipleStreams) {
   envoy_stream_t stream2 = 2;
   // Start stream1.
   // Setup bridge_callbacks to handle the response headers.
-  envoy_http_callbacks bridge_callbacks;
+  envoy_http_callbacks bridge_callbacks{};
   callbacks_called cc = {0, 0, 0, 0, 0, 0};
   bridge_callbacks.context = &cc;
   bridge_callbacks.on_headers = [](envoy_headers c_headers, bool end_stream,
@@ -544,7 +659,7 @@ TEST_F(ClientTest, MultipleStreams) {
     cc->on_headers_calls++;
     return nullptr;
   };
-  bridge_callbacks.on_complete = [](void* context) -> void* {
+  bridge_callbacks.on_complete = [](envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_complete_calls++;
     return nullptr;
@@ -577,7 +692,7 @@ TEST_F(ClientTest, MultipleStreams) {
   // Setup bridge_callbacks to handle the response headers.
   NiceMock<MockRequestDecoder> request_decoder2;
   ResponseEncoder* response_encoder2{};
-  envoy_http_callbacks bridge_callbacks2;
+  envoy_http_callbacks bridge_callbacks2{};
   callbacks_called cc2 = {0, 0, 0, 0, 0, 0};
   bridge_callbacks2.context = &cc2;
   bridge_callbacks2.on_headers = [](envoy_headers c_headers, bool end_stream,
@@ -589,7 +704,7 @@ TEST_F(ClientTest, MultipleStreams) {
     *on_headers_called2 = true;
     return nullptr;
   };
-  bridge_callbacks2.on_complete = [](void* context) -> void* {
+  bridge_callbacks2.on_complete = [](envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_complete_calls++;
     return nullptr;
@@ -637,7 +752,7 @@ TEST_F(ClientTest, MultipleStreams) {
 TEST_F(ClientTest, EnvoyLocalReplyNotAnError) {
   envoy_stream_t stream = 1;
   // Setup bridge_callbacks to handle the response headers.
-  envoy_http_callbacks bridge_callbacks;
+  envoy_http_callbacks bridge_callbacks{};
   callbacks_called cc = {0, 0, 0, 0, 0, 0};
   bridge_callbacks.context = &cc;
   bridge_callbacks.on_headers = [](envoy_headers c_headers, bool end_stream,
@@ -649,12 +764,12 @@ TEST_F(ClientTest, EnvoyLocalReplyNotAnError) {
     cc->on_headers_calls++;
     return nullptr;
   };
-  bridge_callbacks.on_complete = [](void* context) -> void* {
+  bridge_callbacks.on_complete = [](envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_complete_calls++;
     return nullptr;
   };
-  bridge_callbacks.on_error = [](envoy_error, void* context) -> void* {
+  bridge_callbacks.on_error = [](envoy_error, envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_error_calls++;
     return nullptr;
@@ -697,7 +812,7 @@ TEST_F(ClientTest, EnvoyLocalReplyNotAnError) {
 TEST_F(ClientTest, EnvoyLocalReplyNon503NotAnError) {
   envoy_stream_t stream = 1;
   // Setup bridge_callbacks to handle the response headers.
-  envoy_http_callbacks bridge_callbacks;
+  envoy_http_callbacks bridge_callbacks{};
   callbacks_called cc = {0, 0, 0, 0, 0, 0};
   bridge_callbacks.context = &cc;
   bridge_callbacks.on_headers = [](envoy_headers c_headers, bool end_stream,
@@ -709,12 +824,12 @@ TEST_F(ClientTest, EnvoyLocalReplyNon503NotAnError) {
     cc->on_headers_calls++;
     return nullptr;
   };
-  bridge_callbacks.on_complete = [](void* context) -> void* {
+  bridge_callbacks.on_complete = [](envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_complete_calls++;
     return nullptr;
   };
-  bridge_callbacks.on_error = [](envoy_error, void* context) -> void* {
+  bridge_callbacks.on_error = [](envoy_error, envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_error_calls++;
     return nullptr;
@@ -757,7 +872,7 @@ TEST_F(ClientTest, EnvoyLocalReplyNon503NotAnError) {
 TEST_F(ClientTest, EnvoyResponseWithErrorCode) {
   envoy_stream_t stream = 1;
   // Setup bridge_callbacks to handle the response headers.
-  envoy_http_callbacks bridge_callbacks;
+  envoy_http_callbacks bridge_callbacks{};
   callbacks_called cc = {0, 0, 0, 0, 0, 0};
   bridge_callbacks.context = &cc;
   bridge_callbacks.on_headers = [](envoy_headers c_headers, bool, void* context) -> void* {
@@ -773,14 +888,16 @@ TEST_F(ClientTest, EnvoyResponseWithErrorCode) {
     c_data.release(c_data.context);
     return nullptr;
   };
-  bridge_callbacks.on_complete = [](void* context) -> void* {
+  bridge_callbacks.on_complete = [](envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_complete_calls++;
     return nullptr;
   };
-  bridge_callbacks.on_error = [](envoy_error error, void* context) -> void* {
+  bridge_callbacks.on_error = [](envoy_error error, envoy_stream_intel stream_intel,
+                                 void* context) -> void* {
     EXPECT_EQ(error.error_code, ENVOY_CONNECTION_FAILURE);
     EXPECT_EQ(error.attempt_count, 123);
+    EXPECT_EQ(stream_intel.attempt_count, 123);
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_error_calls++;
     error.message.release(error.message.context);
@@ -828,20 +945,20 @@ TEST_F(ClientTest, EnvoyResponseWithErrorCode) {
 
 TEST_F(ClientTest, ResetStreamLocal) {
   envoy_stream_t stream = 1;
-  envoy_http_callbacks bridge_callbacks;
+  envoy_http_callbacks bridge_callbacks{};
   callbacks_called cc = {0, 0, 0, 0, 0, 0};
   bridge_callbacks.context = &cc;
-  bridge_callbacks.on_error = [](envoy_error, void* context) -> void* {
+  bridge_callbacks.on_error = [](envoy_error, envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_error_calls++;
     return nullptr;
   };
-  bridge_callbacks.on_complete = [](void* context) -> void* {
+  bridge_callbacks.on_complete = [](envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_complete_calls++;
     return nullptr;
   };
-  bridge_callbacks.on_cancel = [](void* context) -> void* {
+  bridge_callbacks.on_cancel = [](envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_cancel_calls++;
     return nullptr;
@@ -869,20 +986,20 @@ TEST_F(ClientTest, ResetStreamLocal) {
 
 TEST_F(ClientTest, DoubleResetStreamLocal) {
   envoy_stream_t stream = 1;
-  envoy_http_callbacks bridge_callbacks;
+  envoy_http_callbacks bridge_callbacks{};
   callbacks_called cc = {0, 0, 0, 0, 0, 0};
   bridge_callbacks.context = &cc;
-  bridge_callbacks.on_error = [](envoy_error, void* context) -> void* {
+  bridge_callbacks.on_error = [](envoy_error, envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_error_calls++;
     return nullptr;
   };
-  bridge_callbacks.on_complete = [](void* context) -> void* {
+  bridge_callbacks.on_complete = [](envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_complete_calls++;
     return nullptr;
   };
-  bridge_callbacks.on_cancel = [](void* context) -> void* {
+  bridge_callbacks.on_cancel = [](envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_cancel_calls++;
     return nullptr;
@@ -915,7 +1032,7 @@ TEST_F(ClientTest, DoubleResetStreamLocal) {
 TEST_F(ClientTest, RemoteResetAfterStreamStart) {
   envoy_stream_t stream = 1;
   // Setup bridge_callbacks to handle the response headers.
-  envoy_http_callbacks bridge_callbacks;
+  envoy_http_callbacks bridge_callbacks{};
   callbacks_called cc = {0, 0, 0, 0, 0, 0};
   bridge_callbacks.context = &cc;
   bridge_callbacks.on_headers = [](envoy_headers c_headers, bool end_stream,
@@ -927,12 +1044,12 @@ TEST_F(ClientTest, RemoteResetAfterStreamStart) {
     cc->on_headers_calls++;
     return nullptr;
   };
-  bridge_callbacks.on_complete = [](void* context) -> void* {
+  bridge_callbacks.on_complete = [](envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_complete_calls++;
     return nullptr;
   };
-  bridge_callbacks.on_error = [](envoy_error error, void* context) -> void* {
+  bridge_callbacks.on_error = [](envoy_error error, envoy_stream_intel, void* context) -> void* {
     EXPECT_EQ(error.error_code, ENVOY_STREAM_RESET);
     EXPECT_EQ(error.message.length, 0);
     EXPECT_EQ(error.attempt_count, -1);
@@ -942,7 +1059,7 @@ TEST_F(ClientTest, RemoteResetAfterStreamStart) {
     cc->on_error_calls++;
     return nullptr;
   };
-  bridge_callbacks.on_cancel = [](void* context) -> void* {
+  bridge_callbacks.on_cancel = [](envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_cancel_calls++;
     return nullptr;
@@ -996,7 +1113,7 @@ TEST_F(ClientTest, RemoteResetAfterStreamStart) {
 TEST_F(ClientTest, StreamResetAfterOnComplete) {
   envoy_stream_t stream = 1;
   // Setup bridge_callbacks to handle the response headers.
-  envoy_http_callbacks bridge_callbacks;
+  envoy_http_callbacks bridge_callbacks{};
   callbacks_called cc = {0, 0, 0, 0, 0, 0};
   bridge_callbacks.context = &cc;
   bridge_callbacks.on_headers = [](envoy_headers c_headers, bool end_stream,
@@ -1008,12 +1125,12 @@ TEST_F(ClientTest, StreamResetAfterOnComplete) {
     cc->on_headers_calls++;
     return nullptr;
   };
-  bridge_callbacks.on_complete = [](void* context) -> void* {
+  bridge_callbacks.on_complete = [](envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_complete_calls++;
     return nullptr;
   };
-  bridge_callbacks.on_cancel = [](void* context) -> void* {
+  bridge_callbacks.on_cancel = [](envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_cancel_calls++;
     return nullptr;
@@ -1058,7 +1175,7 @@ TEST_F(ClientTest, StreamResetAfterOnComplete) {
 TEST_F(ClientTest, ResetWhenRemoteClosesBeforeLocal) {
   envoy_stream_t stream = 1;
   // Setup bridge_callbacks to handle the response headers.
-  envoy_http_callbacks bridge_callbacks;
+  envoy_http_callbacks bridge_callbacks{};
   callbacks_called cc = {0, 0, 0, 0, 0, 0};
   bridge_callbacks.context = &cc;
   bridge_callbacks.on_headers = [](envoy_headers c_headers, bool end_stream,
@@ -1070,7 +1187,7 @@ TEST_F(ClientTest, ResetWhenRemoteClosesBeforeLocal) {
     cc->on_headers_calls++;
     return nullptr;
   };
-  bridge_callbacks.on_complete = [](void* context) -> void* {
+  bridge_callbacks.on_complete = [](envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_complete_calls++;
     return nullptr;
@@ -1101,9 +1218,464 @@ TEST_F(ClientTest, ResetWhenRemoteClosesBeforeLocal) {
   ASSERT_EQ(cc.on_error_calls, 0);
 }
 
+// Records what the platform receives on a stream with explicit flow control.
+struct FlowControlledResponse {
+  std::vector<std::string> data;
+  std::vector<bool> end_streams;
+  uint32_t on_trailers_calls;
+  uint32_t on_complete_calls;
+  uint32_t on_cancel_calls;
+  uint32_t on_send_window_available_calls;
+};
+
+envoy_http_callbacks flowControlledCallbacks(FlowControlledResponse& response) {
+  envoy_http_callbacks bridge_callbacks{};
+  bridge_callbacks.context = &response;
+  bridge_callbacks.on_data = [](envoy_data c_data, bool end_stream, void* context) -> void* {
+    auto* response = static_cast<FlowControlledResponse*>(context);
+    response->data.push_back(Data::Utility::copyToString(c_data));
+    response->end_streams.push_back(end_stream);
+    c_data.release(c_data.context);
+    return nullptr;
+  };
+  bridge_callbacks.on_trailers = [](envoy_headers c_trailers, void* context) -> void* {
+    release_envoy_headers(c_trailers);
+    static_cast<FlowControlledResponse*>(context)->on_trailers_calls++;
+    return nullptr;
+  };
+  bridge_callbacks.on_complete = [](envoy_stream_intel, void* context) -> void* {
+    static_cast<FlowControlledResponse*>(context)->on_complete_calls++;
+    return nullptr;
+  };
+  bridge_callbacks.on_cancel = [](envoy_stream_intel, void* context) -> void* {
+    static_cast<FlowControlledResponse*>(context)->on_cancel_calls++;
+    return nullptr;
+  };
+  bridge_callbacks.on_send_window_available = [](void* context) -> void* {
+    static_cast<FlowControlledResponse*>(context)->on_send_window_available_calls++;
+    return nullptr;
+  };
+  return bridge_callbacks;
+}
+
+TEST_F(ClientTest, ExplicitFlowControl) {
+  envoy_stream_t stream = 1;
+  FlowControlledResponse response{};
+
+  ON_CALL(dispatcher_, isThreadSafe()).WillByDefault(Return(true));
+  EXPECT_CALL(api_listener_, newStream(_, _))
+      .WillOnce(Invoke([&](ResponseEncoder& encoder, bool) -> RequestDecoder& {
+        response_encoder_ = &encoder;
+        return request_decoder_;
+      }));
+  http_client_.startStream(stream, flowControlledCallbacks(response), true);
+
+  // Data is held until the platform asks for it.
+  Buffer::OwnedImpl first("response ");
+  response_encoder_->encodeData(first, false);
+  ASSERT_TRUE(response.data.empty());
+
+  http_client_.readData(stream, 4);
+  ASSERT_EQ(response.data, std::vector<std::string>({"resp"}));
+  ASSERT_EQ(response.end_streams, std::vector<bool>({false}));
+
+  http_client_.readData(stream, 100);
+  ASSERT_EQ(response.data.size(), 2);
+  ASSERT_EQ(response.data[1], "onse ");
+
+  // A window granted ahead of the data is used as soon as data arrives.
+  http_client_.readData(stream, 100);
+  Buffer::OwnedImpl second("body");
+  response_encoder_->encodeData(second, false);
+  ASSERT_EQ(response.data.size(), 3);
+  ASSERT_EQ(response.data[2], "body");
+
+  // Once the response ends in Envoy, the stream stays readable until it has been drained. The
+  // reset Envoy issues because the request is still open is not reported to the platform.
+  Buffer::OwnedImpl third(" and more");
+  response_encoder_->encodeData(third, true);
+  response_encoder_->getStream().resetStream(StreamResetReason::RemoteReset);
+  ASSERT_EQ(response.data.size(), 3);
+
+  EXPECT_CALL(dispatcher_, deferredDelete_(_));
+  http_client_.readData(stream, 100);
+  ASSERT_EQ(response.data.size(), 4);
+  ASSERT_EQ(response.data[3], " and more");
+  ASSERT_EQ(response.end_streams[3], true);
+  ASSERT_EQ(response.on_complete_calls, 1);
+}
+
+TEST_F(ClientTest, ExplicitFlowControlTrailers) {
+  envoy_stream_t stream = 1;
+  FlowControlledResponse response{};
+
+  ON_CALL(dispatcher_, isThreadSafe()).WillByDefault(Return(true));
+  EXPECT_CALL(api_listener_, newStream(_, _))
+      .WillOnce(Invoke([&](ResponseEncoder& encoder, bool) -> RequestDecoder& {
+        response_encoder_ = &encoder;
+        return request_decoder_;
+      }));
+  http_client_.startStream(stream, flowControlledCallbacks(response), true);
+
+  Buffer::OwnedImpl data("response body");
+  response_encoder_->encodeData(data, false);
+  TestResponseTrailerMapImpl trailers{{"x-test-trailer", "test_trailer"}};
+  response_encoder_->encodeTrailers(trailers);
+
+  http_client_.readData(stream, 8);
+  ASSERT_EQ(response.on_trailers_calls, 0);
+
+  EXPECT_CALL(dispatcher_, deferredDelete_(_));
+  http_client_.readData(stream, 8);
+  ASSERT_EQ(response.data, std::vector<std::string>({"response", " body"}));
+  ASSERT_EQ(response.end_streams, std::vector<bool>({false, false}));
+  ASSERT_EQ(response.on_trailers_calls, 1);
+  ASSERT_EQ(response.on_complete_calls, 1);
+}
+
+TEST_F(ClientTest, ExplicitFlowControlCancelWhileBuffered) {
+  envoy_stream_t stream = 1;
+  FlowControlledResponse response{};
+
+  ON_CALL(dispatcher_, isThreadSafe()).WillByDefault(Return(true));
+  EXPECT_CALL(api_listener_, newStream(_, _))
+      .WillOnce(Invoke([&](ResponseEncoder& encoder, bool) -> RequestDecoder& {
+        response_encoder_ = &encoder;
+        return request_decoder_;
+      }));
+  http_client_.startStream(stream, flowControlledCallbacks(response), true);
+
+  Buffer::OwnedImpl data("response body");
+  response_encoder_->encodeData(data, false);
+  TestResponseTrailerMapImpl trailers{{"x-test-trailer", "test_trailer"}};
+  response_encoder_->encodeTrailers(trailers);
+
+  // Envoy is already done with the stream, so cancelling it only notifies the platform.
+  MockStreamCallbacks stream_callbacks;
+  response_encoder_->getStream().addCallbacks(stream_callbacks);
+  EXPECT_CALL(stream_callbacks, onResetStream(_, _)).Times(0);
+  EXPECT_CALL(dispatcher_, deferredDelete_(_));
+  http_client_.cancelStream(stream);
+  ASSERT_EQ(response.on_cancel_calls, 1);
+  ASSERT_TRUE(response.data.empty());
+
+  http_client_.readData(stream, 100);
+  ASSERT_TRUE(response.data.empty());
+  ASSERT_EQ(response.on_trailers_calls, 0);
+}
+
+TEST_F(ClientTest, ExplicitFlowControlWatermarks) {
+  envoy_stream_t stream = 1;
+  FlowControlledResponse response{};
+
+  ON_CALL(dispatcher_, isThreadSafe()).WillByDefault(Return(true));
+  EXPECT_CALL(api_listener_, newStream(_, _))
+      .WillOnce(Invoke([&](ResponseEncoder& encoder, bool) -> RequestDecoder& {
+        response_encoder_ = &encoder;
+        return request_decoder_;
+      }));
+  http_client_.startStream(stream, flowControlledCallbacks(response), true);
+  MockStreamCallbacks stream_callbacks;
+  response_encoder_->getStream().addCallbacks(stream_callbacks);
+  const uint32_t limit = response_encoder_->getStream().bufferLimit();
+  EXPECT_EQ(Client::DefaultBufferLimit, limit);
+
+  // Buffering past the limit asks Envoy to stop reading the response.
+  EXPECT_CALL(stream_callbacks, onAboveWriteBufferHighWatermark());
+  Buffer::OwnedImpl data(std::string(limit + 1, 'a'));
+  response_encoder_->encodeData(data, false);
+
+  // Reading down to half the limit lets it resume.
+  http_client_.readData(stream, limit / 4);
+  EXPECT_CALL(stream_callbacks, onBelowWriteBufferLowWatermark());
+  http_client_.readData(stream, limit / 2);
+  ASSERT_EQ(response.data.size(), 2);
+
+  EXPECT_CALL(stream_callbacks, onResetStream(_, _));
+  EXPECT_CALL(dispatcher_, deferredDelete_(_));
+  http_client_.cancelStream(stream);
+}
+
+TEST_F(ClientTest, ExplicitFlowControlConfiguredBufferLimit) {
+  envoy_stream_t stream = 1;
+  FlowControlledResponse response{};
+
+  ON_CALL(dispatcher_, isThreadSafe()).WillByDefault(Return(true));
+  EXPECT_CALL(api_listener_, newStream(_, _))
+      .WillOnce(Invoke([&](ResponseEncoder& encoder, bool) -> RequestDecoder& {
+        // Envoy reads the limit as soon as the stream is created.
+        EXPECT_EQ(1000, encoder.getStream().bufferLimit());
+        response_encoder_ = &encoder;
+        return request_decoder_;
+      }));
+  http_client_.startStream(stream, flowControlledCallbacks(response), true, absl::nullopt, 1000);
+  MockStreamCallbacks stream_callbacks;
+  response_encoder_->getStream().addCallbacks(stream_callbacks);
+
+  // Exactly the limit is still within it.
+  EXPECT_CALL(stream_callbacks, onAboveWriteBufferHighWatermark()).Times(0);
+  Buffer::OwnedImpl data(std::string(1000, 'a'));
+  response_encoder_->encodeData(data, false);
+  testing::Mock::VerifyAndClearExpectations(&stream_callbacks);
+
+  EXPECT_CALL(stream_callbacks, onAboveWriteBufferHighWatermark());
+  Buffer::OwnedImpl more_data(std::string(1, 'a'));
+  response_encoder_->encodeData(more_data, false);
+  testing::Mock::VerifyAndClearExpectations(&stream_callbacks);
+
+  // Envoy resumes only once no more than half of the limit is buffered.
+  EXPECT_CALL(stream_callbacks, onBelowWriteBufferLowWatermark()).Times(0);
+  http_client_.readData(stream, 500);
+  testing::Mock::VerifyAndClearExpectations(&stream_callbacks);
+
+  EXPECT_CALL(stream_callbacks, onBelowWriteBufferLowWatermark());
+  http_client_.readData(stream, 1);
+  ASSERT_EQ(response.data.size(), 2);
+
+  EXPECT_CALL(stream_callbacks, onResetStream(_, _));
+  EXPECT_CALL(dispatcher_, deferredDelete_(_));
+  http_client_.cancelStream(stream);
+}
+
+TEST_F(ClientTest, ExplicitFlowControlNoWatermarksAfterEndStream) {
+  envoy_stream_t stream = 1;
+  FlowControlledResponse response{};
+
+  ON_CALL(dispatcher_, isThreadSafe()).WillByDefault(Return(true));
+  EXPECT_CALL(api_listener_, newStream(_, _))
+      .WillOnce(Invoke([&](ResponseEncoder& encoder, bool) -> RequestDecoder& {
+        response_encoder_ = &encoder;
+        return request_decoder_;
+      }));
+  http_client_.startStream(stream, flowControlledCallbacks(response), true);
+  MockStreamCallbacks stream_callbacks;
+  response_encoder_->getStream().addCallbacks(stream_callbacks);
+  const uint32_t limit = response_encoder_->getStream().bufferLimit();
+
+  // Envoy has finished the response, so buffering past the limit does not push back on it.
+  EXPECT_CALL(stream_callbacks, onAboveWriteBufferHighWatermark()).Times(0);
+  EXPECT_CALL(stream_callbacks, onBelowWriteBufferLowWatermark()).Times(0);
+  Buffer::OwnedImpl data(std::string(limit + 1, 'a'));
+  response_encoder_->encodeData(data, true);
+
+  EXPECT_CALL(dispatcher_, deferredDelete_(_));
+  http_client_.readData(stream, limit + 1);
+  ASSERT_EQ(response.data.size(), 1);
+  ASSERT_EQ(response.end_streams[0], true);
+  ASSERT_EQ(response.on_complete_calls, 1);
+}
+
+TEST_F(ClientTest, ExplicitFlowControlSendWindow) {
+  envoy_stream_t stream = 1;
+  FlowControlledResponse response{};
+
+  ON_CALL(dispatcher_, isThreadSafe()).WillByDefault(Return(true));
+  EXPECT_CALL(api_listener_, newStream(_, _))
+      .WillOnce(Invoke([&](ResponseEncoder& encoder, bool) -> RequestDecoder& {
+        response_encoder_ = &encoder;
+        return request_decoder_;
+      }));
+  http_client_.startStream(stream, flowControlledCallbacks(response), true);
+
+  // With no backpressure, the window is available again as soon as the data is handed to Envoy.
+  Buffer::OwnedImpl first("first");
+  EXPECT_CALL(request_decoder_, decodeData(BufferStringEqual("first"), false));
+  http_client_.sendData(stream, Data::Utility::toBridgeData(first), false);
+  ASSERT_EQ(response.on_send_window_available_calls, 1);
+
+  // While Envoy applies backpressure, the window stays closed until every readDisable is undone.
+  Buffer::OwnedImpl second("second");
+  EXPECT_CALL(request_decoder_, decodeData(BufferStringEqual("second"), false))
+      .WillOnce(Invoke([&](Buffer::Instance&, bool) {
+        response_encoder_->getStream().readDisable(true);
+        response_encoder_->getStream().readDisable(true);
+      }));
+  http_client_.sendData(stream, Data::Utility::toBridgeData(second), false);
+  ASSERT_EQ(response.on_send_window_available_calls, 1);
+  response_encoder_->getStream().readDisable(false);
+  ASSERT_EQ(response.on_send_window_available_calls, 1);
+  response_encoder_->getStream().readDisable(false);
+  ASSERT_EQ(response.on_send_window_available_calls, 2);
+
+  // The final data is not followed by a window.
+  Buffer::OwnedImpl last("last");
+  EXPECT_CALL(request_decoder_, decodeData(BufferStringEqual("last"), true));
+  http_client_.sendData(stream, Data::Utility::toBridgeData(last), true);
+  ASSERT_EQ(response.on_send_window_available_calls, 2);
+
+  EXPECT_CALL(dispatcher_, deferredDelete_(_));
+  http_client_.cancelStream(stream);
+}
+
+TEST_F(ClientTest, TimeToFirstRequestDispatched) {
+  envoy_http_callbacks bridge_callbacks{};
+
+  ON_CALL(dispatcher_, isThreadSafe()).WillByDefault(Return(true));
+  EXPECT_CALL(api_listener_, newStream(_, _)).WillRepeatedly(ReturnRef(request_decoder_));
+
+  http_client_.setEngineStartTime(time_system_.monotonicTime());
+  time_system_.advanceTimeWait(std::chrono::milliseconds(25));
+  http_client_.startStream(1, bridge_callbacks);
+  time_system_.advanceTimeWait(std::chrono::milliseconds(25));
+  http_client_.startStream(2, bridge_callbacks);
+
+  // Only the first stream after the engine started is measured.
+  EXPECT_EQ(std::vector<uint64_t>{25},
+            stats_store_.histogramValues("http.client.time_to_first_request_dispatched", false));
+}
+
+TEST_F(ClientTest, StreamTimings) {
+  envoy_stream_t stream = 1;
+  envoy_stream_timings timings{};
+  envoy_http_callbacks bridge_callbacks{};
+  bridge_callbacks.context = &timings;
+  bridge_callbacks.on_headers = [](envoy_headers c_headers, bool, void*) -> void* {
+    release_envoy_headers(c_headers);
+    return nullptr;
+  };
+  bridge_callbacks.on_data = [](envoy_data c_data, bool, void*) -> void* {
+    c_data.release(c_data.context);
+    return nullptr;
+  };
+  bridge_callbacks.on_complete = [](envoy_stream_intel, void*) -> void* { return nullptr; };
+  bridge_callbacks.on_stream_timings = [](envoy_stream_timings timings, void* context) -> void* {
+    *static_cast<envoy_stream_timings*>(context) = timings;
+    return nullptr;
+  };
+
+  ON_CALL(dispatcher_, isThreadSafe()).WillByDefault(Return(true));
+  EXPECT_CALL(api_listener_, newStream(_, _))
+      .WillOnce(Invoke([&](ResponseEncoder& encoder, bool) -> RequestDecoder& {
+        response_encoder_ = &encoder;
+        return request_decoder_;
+      }));
+
+  // Phases are measured from the platform's call.
+  const MonotonicTime api_call_time = time_system_.monotonicTime();
+  time_system_.advanceTimeWait(std::chrono::milliseconds(1));
+  http_client_.startStream(stream, bridge_callbacks, false, api_call_time);
+
+  time_system_.advanceTimeWait(std::chrono::milliseconds(2));
+  TestResponseHeaderMapImpl response_headers{{":status", "200"}};
+  response_encoder_->encodeHeaders(response_headers, false);
+
+  time_system_.advanceTimeWait(std::chrono::milliseconds(3));
+  Buffer::OwnedImpl first("response ");
+  response_encoder_->encodeData(first, false);
+
+  time_system_.advanceTimeWait(std::chrono::milliseconds(4));
+  EXPECT_CALL(dispatcher_, deferredDelete_(_));
+  Buffer::OwnedImpl last("body");
+  response_encoder_->encodeData(last, true);
+
+  EXPECT_EQ(timings.stream_start_us, 1000);
+  EXPECT_EQ(timings.response_headers_us, 3000);
+  EXPECT_EQ(timings.first_response_data_us, 6000);
+  EXPECT_EQ(timings.last_response_data_us, 10000);
+  EXPECT_EQ(timings.terminal_us, 10000);
+}
+
+TEST_F(ClientTest, StreamTimingsForCancelledStream) {
+  envoy_stream_t stream = 1;
+  envoy_stream_timings timings{};
+  envoy_http_callbacks bridge_callbacks{};
+  bridge_callbacks.context = &timings;
+  bridge_callbacks.on_cancel = [](envoy_stream_intel, void*) -> void* { return nullptr; };
+  bridge_callbacks.on_stream_timings = [](envoy_stream_timings timings, void* context) -> void* {
+    *static_cast<envoy_stream_timings*>(context) = timings;
+    return nullptr;
+  };
+
+  ON_CALL(dispatcher_, isThreadSafe()).WillByDefault(Return(true));
+  EXPECT_CALL(api_listener_, newStream(_, _)).WillOnce(ReturnRef(request_decoder_));
+
+  // Without the platform's call time, phases are measured from the start of the stream.
+  http_client_.startStream(stream, bridge_callbacks);
+  time_system_.advanceTimeWait(std::chrono::milliseconds(5));
+  EXPECT_CALL(dispatcher_, deferredDelete_(_));
+  http_client_.cancelStream(stream);
+
+  EXPECT_EQ(timings.stream_start_us, 0);
+  EXPECT_EQ(timings.response_headers_us, -1);
+  EXPECT_EQ(timings.first_response_data_us, -1);
+  EXPECT_EQ(timings.last_response_data_us, -1);
+  EXPECT_EQ(timings.terminal_us, 5000);
+}
+
+TEST_F(ClientTest, StreamIntel) {
+  envoy_stream_t stream = 1;
+  envoy_stream_intel stream_intel{};
+  envoy_http_callbacks bridge_callbacks{};
+  bridge_callbacks.context = &stream_intel;
+  bridge_callbacks.on_headers = [](envoy_headers c_headers, bool, void*) -> void* {
+    release_envoy_headers(c_headers);
+    return nullptr;
+  };
+  bridge_callbacks.on_data = [](envoy_data c_data, bool, void*) -> void* {
+    c_data.release(c_data.context);
+    return nullptr;
+  };
+  bridge_callbacks.on_complete = [](envoy_stream_intel stream_intel, void* context) -> void* {
+    *static_cast<envoy_stream_intel*>(context) = stream_intel;
+    return nullptr;
+  };
+
+  ON_CALL(dispatcher_, isThreadSafe()).WillByDefault(Return(true));
+  EXPECT_CALL(api_listener_, newStream(_, _))
+      .WillOnce(Invoke([&](ResponseEncoder& encoder, bool) -> RequestDecoder& {
+        response_encoder_ = &encoder;
+        return request_decoder_;
+      }));
+  http_client_.startStream(stream, bridge_callbacks);
+
+  TestRequestHeaderMapImpl headers;
+  HttpTestUtility::addDefaultHeaders(headers);
+  EXPECT_CALL(request_decoder_, decodeHeaders_(_, false));
+  http_client_.sendHeaders(stream, Utility::toBridgeHeaders(headers), false);
+  EXPECT_CALL(request_decoder_, decodeData(_, true));
+  http_client_.sendData(stream, Data::Utility::copyToBridgeData("request"), true);
+
+  TestResponseHeaderMapImpl response_headers{
+      {":status", "200"}, {"x-envoy-attempt-count", "2"}, {"x-envoy-upstream-service-time", "35"}};
+  response_encoder_->encodeHeaders(response_headers, false);
+  Buffer::OwnedImpl first("response ");
+  response_encoder_->encodeData(first, false);
+  EXPECT_CALL(dispatcher_, deferredDelete_(_));
+  Buffer::OwnedImpl last("body");
+  response_encoder_->encodeData(last, true);
+
+  EXPECT_EQ(stream_intel.attempt_count, 2);
+  EXPECT_EQ(stream_intel.upstream_service_time_ms, 35);
+  EXPECT_EQ(stream_intel.sent_byte_count, 7);
+  EXPECT_EQ(stream_intel.received_byte_count, 13);
+}
+
+TEST_F(ClientTest, StreamIntelForCancelledStream) {
+  envoy_stream_t stream = 1;
+  envoy_stream_intel stream_intel{};
+  envoy_http_callbacks bridge_callbacks{};
+  bridge_callbacks.context = &stream_intel;
+  bridge_callbacks.on_cancel = [](envoy_stream_intel stream_intel, void* context) -> void* {
+    *static_cast<envoy_stream_intel*>(context) = stream_intel;
+    return nullptr;
+  };
+
+  ON_CALL(dispatcher_, isThreadSafe()).WillByDefault(Return(true));
+  EXPECT_CALL(api_listener_, newStream(_, _)).WillOnce(ReturnRef(request_decoder_));
+  http_client_.startStream(stream, bridge_callbacks);
+  EXPECT_CALL(dispatcher_, deferredDelete_(_));
+  http_client_.cancelStream(stream);
+
+  // Nothing reached an upstream.
+  EXPECT_EQ(stream_intel.attempt_count, -1);
+  EXPECT_EQ(stream_intel.upstream_service_time_ms, -1);
+  EXPECT_EQ(stream_intel.sent_byte_count, 0);
+  EXPECT_EQ(stream_intel.received_byte_count, 0);
+}
+
 TEST_F(ClientTest, Encode100Continue) {
   envoy_stream_t stream = 1;
-  envoy_http_callbacks bridge_callbacks;
+  envoy_http_callbacks bridge_callbacks{};
 
   // Build a set of request headers.
   TestRequestHeaderMapImpl headers;
@@ -1137,7 +1709,7 @@ TEST_F(ClientTest, Encode100Continue) {
 TEST_F(ClientTest, EncodeMetadata) {
   envoy_stream_t stream = 1;
   // Setup bridge_callbacks to handle the response headers.
-  envoy_http_callbacks bridge_callbacks;
+  envoy_http_callbacks bridge_callbacks{};
   callbacks_called cc = {0, 0, 0, 0, 0, 0};
   bridge_callbacks.context = &cc;
   bridge_callbacks.on_headers = [](envoy_headers c_headers, bool end_stream,
@@ -1187,7 +1759,7 @@ TEST_F(ClientTest, EncodeMetadata) {
 
 TEST_F(ClientTest, NullAccessors) {
   envoy_stream_t stream = 1;
-  envoy_http_callbacks bridge_callbacks;
+  envoy_http_callbacks bridge_callbacks{};
 
   // Create a stream.
   ON_CALL(dispatcher_, isThreadSafe()).WillByDefault(Return(true));
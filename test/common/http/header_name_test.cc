@@ -0,0 +1,65 @@
+#include <string>
+
+#include "absl/strings/ascii.h"
+#include "gtest/gtest.h"
+#include "library/common/http/header_name.h"
+
+namespace Envoy {
+namespace Http {
+
+TEST(HeaderNameTest, ScanHeaderName) {
+  EXPECT_EQ(Utility::scanHeaderName(""), Utility::HeaderNameCase::Lower);
+  EXPECT_EQ(Utility::scanHeaderName(":authority"), Utility::HeaderNameCase::Lower);
+  EXPECT_EQ(Utility::scanHeaderName("x-some-long-header-name_with~tokens!"),
+            Utility::HeaderNameCase::Lower);
+  EXPECT_EQ(Utility::scanHeaderName("x-some-long-header-name-With-capitals"),
+            Utility::HeaderNameCase::Mixed);
+  EXPECT_EQ(Utility::scanHeaderName("x-some-long-header-name with-space"),
+            Utility::HeaderNameCase::Invalid);
+  EXPECT_EQ(Utility::scanHeaderName("X-Short(Invalid)"), Utility::HeaderNameCase::Invalid);
+  EXPECT_EQ(Utility::scanHeaderName(std::string("x-nul\0-in-the-middle-of-a-name", 30)),
+            Utility::HeaderNameCase::Invalid);
+
+  // Every byte value, at positions covered by both the vector and scalar paths.
+  const std::string separators = "\"(),/;<=>?@[\\]{}";
+  for (int c = 0; c < 256; c++) {
+    const bool valid =
+        c >= 0x21 && c <= 0x7e && separators.find(static_cast<char>(c)) == std::string::npos;
+    for (size_t position : {0, 15, 16, 33}) {
+      std::string name(34, 'a');
+      name[position] = static_cast<char>(c);
+      const Utility::HeaderNameCase expected =
+          !valid ? Utility::HeaderNameCase::Invalid
+                 : (c >= 'A' && c <= 'Z' ? Utility::HeaderNameCase::Mixed
+                                         : Utility::HeaderNameCase::Lower);
+      EXPECT_EQ(Utility::scanHeaderName(name), expected) << c << " at " << position;
+
+      std::string lowered(name.size(), '\0');
+      EXPECT_EQ(Utility::lowerCaseHeaderName(name, &lowered[0]), valid);
+      EXPECT_EQ(lowered, absl::AsciiStrToLower(name));
+    }
+  }
+}
+
+TEST(HeaderNameTest, LowerCaseHeaderName) {
+  std::string lowered(5, '\0');
+  EXPECT_TRUE(Utility::lowerCaseHeaderName(":Path", &lowered[0]));
+  EXPECT_EQ(lowered, ":path");
+
+  // 19 bytes: an invalid space within the first 16, which the vector path handles, and an
+  // upper-case letter in the 3 byte tail, which the scalar path handles. The whole name is still
+  // lower-cased.
+  const std::string name = "x-bad header-namE-X";
+  ASSERT_GT(name.size(), 16);
+  lowered.assign(name.size(), '\0');
+  EXPECT_FALSE(Utility::lowerCaseHeaderName(name, &lowered[0]));
+  EXPECT_EQ(lowered, "x-bad header-name-x");
+
+  // In place.
+  std::string in_place = "X-Some-Long-Header-Name";
+  EXPECT_TRUE(Utility::lowerCaseHeaderName(in_place, &in_place[0]));
+  EXPECT_EQ(in_place, "x-some-long-header-name");
+}
+
+} // namespace Http
+} // namespace Envoy
@@ -3,6 +3,7 @@
 #include "gtest/gtest.h"
 #include "library/common/data/utility.h"
 #include "library/common/http/header_utility.h"
+#include "library/common/http/interned_headers.h"
 #include "library/common/types/c_types.h"
 
 namespace Envoy {
@@ -76,6 +77,65 @@ TEST(RequestHeaderDataConstructorTest, FromCToCpp) {
   delete sentinel;
 }
 
+TEST(RequestHeaderDataConstructorTest, FromCToCppInternsAndLowerCasesKeys) {
+  std::vector<std::pair<std::string, std::string>> headers = {
+      {":method", "GET"}, {"X-Custom-Header", "Value"}, {"x-other", "other"}};
+
+  envoy_map_entry* header_array = new envoy_map_entry[headers.size()];
+  uint32_t* sentinel = new uint32_t;
+  *sentinel = 0;
+  for (size_t i = 0; i < headers.size(); i++) {
+    header_array[i] = {
+        envoyTestString(headers[i].first, sentinel),
+        envoyTestString(headers[i].second, sentinel),
+    };
+  }
+  envoy_headers c_headers = {static_cast<envoy_map_size_t>(headers.size()), header_array};
+
+  RequestHeaderMapPtr cpp_headers = Utility::toRequestHeaders(c_headers);
+  ASSERT_EQ(*sentinel, 2 * headers.size());
+  ASSERT_EQ(cpp_headers->size(), headers.size());
+
+  // Interned keys reference the static table rather than holding a copy.
+  auto method = cpp_headers->get(LowerCaseString(":method"));
+  ASSERT_EQ(method.size(), 1);
+  EXPECT_EQ(method[0]->key().getStringView().data(),
+            InternedHeaders::get().findName(":method")->get().data());
+  EXPECT_EQ(method[0]->value().getStringView(), "GET");
+
+  // Other keys are lower-cased; values are preserved as-is.
+  auto custom = cpp_headers->get(LowerCaseString("x-custom-header"));
+  ASSERT_EQ(custom.size(), 1);
+  EXPECT_EQ(custom[0]->key().getStringView(), "x-custom-header");
+  EXPECT_EQ(custom[0]->value().getStringView(), "Value");
+
+  auto other = cpp_headers->get(LowerCaseString("x-other"));
+  ASSERT_EQ(other.size(), 1);
+  EXPECT_EQ(other[0]->value().getStringView(), "other");
+
+  delete sentinel;
+}
+
+TEST(RequestHeaderDataConstructorTest, FromCToCppInternsMixedCaseKeys) {
+  std::vector<std::pair<std::string, std::string>> headers = {{"Content-Type", "text/plain"}};
+
+  envoy_map_entry* header_array = new envoy_map_entry[headers.size()];
+  uint32_t* sentinel = new uint32_t;
+  *sentinel = 0;
+  header_array[0] = {envoyTestString(headers[0].first, sentinel),
+                     envoyTestString(headers[0].second, sentinel)};
+  envoy_headers c_headers = {static_cast<envoy_map_size_t>(headers.size()), header_array};
+
+  RequestHeaderMapPtr cpp_headers = Utility::toRequestHeaders(c_headers);
+  auto content_type = cpp_headers->get(LowerCaseString("content-type"));
+  ASSERT_EQ(content_type.size(), 1);
+  EXPECT_EQ(content_type[0]->key().getStringView().data(),
+            InternedHeaders::get().findName("content-type")->get().data());
+  EXPECT_EQ(content_type[0]->value().getStringView(), "text/plain");
+
+  delete sentinel;
+}
+
 TEST(RequestTrailerDataConstructorTest, FromCToCpp) {
   // Backing strings for all the envoy_datas in the c_trailers.
   std::vector<std::pair<std::string, std::string>> trailers = {
@@ -149,5 +209,75 @@ TEST(HeaderDataConstructorTest, FromCppToC) {
   release_envoy_headers(c_headers);
 }
 
+TEST(HeaderDataConstructorTest, FromCppToCIsPacked) {
+  RequestHeaderMapPtr cpp_headers = RequestHeaderMapImpl::create();
+  cpp_headers->addCopy(LowerCaseString(std::string(":method")), std::string("GET"));
+  cpp_headers->addCopy(LowerCaseString(std::string(":path")), std::string("/ping"));
+  cpp_headers->addCopy(LowerCaseString(std::string("x-custom")), std::string("value"));
+
+  envoy_headers c_headers = Utility::toBridgeHeaders(*cpp_headers);
+
+  // All values and non-interned keys live in the same allocation as the entry array, directly
+  // after it.
+  const uint8_t* block_start = reinterpret_cast<const uint8_t*>(c_headers.entries);
+  const uint8_t* bytes_start = block_start + sizeof(envoy_map_entry) * c_headers.length;
+  const uint8_t* bytes_end = bytes_start + cpp_headers->byteSize();
+  for (envoy_map_size_t i = 0; i < c_headers.length; i++) {
+    for (const envoy_data& data : {c_headers.entries[i].key, c_headers.entries[i].value}) {
+      EXPECT_EQ(data.release, envoy_noop_release);
+      if (InternedHeaders::get().lookup(data) != nullptr) {
+        continue;
+      }
+      EXPECT_GE(data.bytes, bytes_start);
+      EXPECT_LE(data.bytes + data.length, bytes_end);
+    }
+  }
+
+  release_envoy_headers(c_headers);
+}
+
+TEST(HeaderDataConstructorTest, FromCppToCInternsCommonKeys) {
+  RequestHeaderMapPtr cpp_headers = RequestHeaderMapImpl::create();
+  cpp_headers->addCopy(LowerCaseString(std::string(":method")), std::string("GET"));
+  cpp_headers->addCopy(LowerCaseString(std::string("x-custom")), std::string("value"));
+
+  envoy_headers c_headers = Utility::toBridgeHeaders(*cpp_headers);
+  ASSERT_EQ(c_headers.length, 2);
+
+  const LowerCaseString* method = InternedHeaders::get().lookup(c_headers.entries[0].key);
+  ASSERT_NE(method, nullptr);
+  EXPECT_EQ(method->get(), ":method");
+  EXPECT_EQ(Data::Utility::copyToString(c_headers.entries[0].key), ":method");
+  EXPECT_EQ(InternedHeaders::get().lookup(c_headers.entries[0].value), nullptr);
+  EXPECT_EQ(InternedHeaders::get().lookup(c_headers.entries[1].key), nullptr);
+
+  release_envoy_headers(c_headers);
+}
+
+TEST(InternedHeadersTest, FindAndLookup) {
+  const InternedHeaderValues& interned_headers = InternedHeaders::get();
+
+  const envoy_data* status = interned_headers.find(":status");
+  ASSERT_NE(status, nullptr);
+  EXPECT_EQ(status, interned_headers.find(":status"));
+  EXPECT_EQ(status->release, envoy_noop_release);
+  ASSERT_NE(interned_headers.lookup(*status), nullptr);
+  EXPECT_EQ(interned_headers.lookup(*status)->get(), ":status");
+
+  EXPECT_EQ(interned_headers.find("x-not-interned"), nullptr);
+  EXPECT_EQ(interned_headers.find("Content-Type"), nullptr);
+
+  // An envoy_data with the same bytes but not from the table is not recognized.
+  envoy_data copy = Data::Utility::copyToBridgeData(":status");
+  EXPECT_EQ(interned_headers.lookup(copy), nullptr);
+  release_envoy_data(copy);
+  EXPECT_EQ(interned_headers.lookup(envoy_nodata), nullptr);
+
+  // A no-op release with a context inside the table but not at an entry is not recognized.
+  envoy_data misaligned = *status;
+  misaligned.context = static_cast<uint8_t*>(status->context) + 1;
+  EXPECT_EQ(interned_headers.lookup(misaligned), nullptr);
+}
+
 } // namespace Http
 } // namespace Envoy
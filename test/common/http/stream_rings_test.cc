@@ -0,0 +1,123 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "library/common/data/utility.h"
+#include "library/common/http/stream_rings.h"
+#include "library/common/types/c_types.h"
+#include "test/common/mocks/event/mocks.h"
+
+using testing::_;
+using testing::NiceMock;
+using testing::Return;
+
+namespace Envoy {
+namespace Http {
+
+class StreamRingsTest : public testing::Test {
+public:
+  StreamRingsTest() {
+    ON_CALL(dispatcher_, post_(_)).WillByDefault(Return(ENVOY_SUCCESS));
+  }
+
+  void runPosted() {
+    auto callbacks = std::move(dispatcher_.callbacks_);
+    dispatcher_.callbacks_.clear();
+    for (auto& callback : callbacks) {
+      callback();
+    }
+  }
+
+  NiceMock<Event::MockProvisionalDispatcher> dispatcher_;
+  std::vector<envoy_stream_operation> applied_;
+  StreamRings rings_{dispatcher_,
+                     [this](const envoy_stream_operation* operations, size_t count) -> void {
+                       applied_.insert(applied_.end(), operations, operations + count);
+                     },
+                     4, 2};
+};
+
+TEST_F(StreamRingsTest, SubmissionsAreAppliedInOrderWithOnePost) {
+  envoy_stream_operation operations[3] = {};
+  for (size_t i = 0; i < 3; i++) {
+    operations[i].type = ENVOY_STREAM_OP_RESET;
+    operations[i].stream = i;
+  }
+
+  EXPECT_CALL(dispatcher_, post_(_));
+  EXPECT_EQ(2, rings_.submit(operations, 2));
+  EXPECT_EQ(1, rings_.submit(operations + 2, 1));
+  EXPECT_TRUE(applied_.empty());
+
+  runPosted();
+  ASSERT_EQ(3, applied_.size());
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_EQ(i, applied_[i].stream);
+  }
+}
+
+TEST_F(StreamRingsTest, SubmitStopsWhenRingIsFull) {
+  envoy_stream_operation operations[6] = {};
+  EXPECT_EQ(4, rings_.submit(operations, 6));
+  runPosted();
+  EXPECT_EQ(4, applied_.size());
+  EXPECT_EQ(2, rings_.submit(operations + 4, 2));
+  runPosted();
+  EXPECT_EQ(6, applied_.size());
+}
+
+TEST_F(StreamRingsTest, CompletionsAreHarvestedInOrderPastCapacity) {
+  envoy_http_callbacks callbacks = rings_.callbacksFor(7);
+
+  callbacks.on_headers(envoy_noheaders, false, callbacks.context);
+  callbacks.on_data(Data::Utility::copyToBridgeData("a"), false, callbacks.context);
+  callbacks.on_data(Data::Utility::copyToBridgeData("b"), true, callbacks.context);
+  callbacks.on_complete({1, 20, 0, 2}, callbacks.context);
+
+  envoy_stream_completion completions[8];
+  ASSERT_EQ(2, rings_.harvest(completions, 2));
+  EXPECT_EQ(ENVOY_STREAM_COMPLETION_HEADERS, completions[0].type);
+  EXPECT_EQ(7, completions[0].stream);
+  EXPECT_FALSE(completions[0].end_stream);
+  EXPECT_EQ(ENVOY_STREAM_COMPLETION_DATA, completions[1].type);
+  EXPECT_EQ("a", Data::Utility::copyToString(completions[1].data));
+  completions[1].data.release(completions[1].data.context);
+
+  ASSERT_EQ(2, rings_.harvest(completions, 8));
+  EXPECT_EQ(ENVOY_STREAM_COMPLETION_DATA, completions[0].type);
+  EXPECT_TRUE(completions[0].end_stream);
+  EXPECT_EQ("b", Data::Utility::copyToString(completions[0].data));
+  completions[0].data.release(completions[0].data.context);
+  EXPECT_EQ(ENVOY_STREAM_COMPLETION_COMPLETE, completions[1].type);
+  EXPECT_EQ(1, completions[1].stream_intel.attempt_count);
+  EXPECT_EQ(2, completions[1].stream_intel.received_byte_count);
+
+  EXPECT_EQ(0, rings_.harvest(completions, 8));
+}
+
+TEST_F(StreamRingsTest, PollTimesOutWithoutCompletions) {
+  envoy_stream_completion completions[1];
+  EXPECT_EQ(0, rings_.poll(completions, 1, std::chrono::milliseconds(0)));
+  EXPECT_EQ(0, rings_.poll(completions, 1, std::chrono::milliseconds(10)));
+}
+
+TEST_F(StreamRingsTest, PollWakesOnCompletion) {
+  envoy_http_callbacks callbacks = rings_.callbacksFor(3);
+  std::thread engine_thread([&callbacks]() -> void {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    callbacks.on_cancel({-1, -1, 0, 0}, callbacks.context);
+  });
+
+  envoy_stream_completion completions[1];
+  size_t polled = 0;
+  while (polled == 0) {
+    polled = rings_.poll(completions, 1, std::chrono::seconds(10));
+  }
+  engine_thread.join();
+  EXPECT_EQ(ENVOY_STREAM_COMPLETION_CANCEL, completions[0].type);
+  EXPECT_EQ(3, completions[0].stream);
+}
+
+} // namespace Http
+} // namespace Envoy
@@ -0,0 +1,118 @@
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "library/common/http/stream_slot_map.h"
+#include "library/common/types/c_types.h"
+
+namespace Envoy {
+namespace Http {
+
+struct TestValue {
+  explicit TestValue(envoy_stream_t handle) : handle_(handle) {}
+  envoy_stream_t handle_;
+};
+
+using TestMap = StreamSlotMap<TestValue>;
+
+TEST(StreamSlotMapTest, InsertFindErase) {
+  TestMap map(4);
+  map.insert(1, std::make_unique<TestValue>(1));
+  map.insert(2, std::make_unique<TestValue>(2));
+  EXPECT_EQ(2, map.size());
+
+  ASSERT_NE(nullptr, map.find(1));
+  EXPECT_EQ(1, map.find(1)->handle_);
+  ASSERT_NE(nullptr, map.find(2));
+  EXPECT_EQ(2, map.find(2)->handle_);
+  EXPECT_EQ(nullptr, map.find(3));
+
+  auto value = map.erase(1);
+  ASSERT_NE(nullptr, value);
+  EXPECT_EQ(1, value->handle_);
+  EXPECT_EQ(nullptr, map.find(1));
+  EXPECT_EQ(nullptr, map.erase(1));
+  EXPECT_EQ(1, map.size());
+}
+
+TEST(StreamSlotMapTest, StaleHandleRejected) {
+  TestMap map(4);
+  map.insert(1, std::make_unique<TestValue>(1));
+  map.erase(1);
+  // Handle 5 reuses the slot that handle 1 occupied.
+  map.insert(5, std::make_unique<TestValue>(5));
+
+  EXPECT_EQ(nullptr, map.find(1));
+  EXPECT_EQ(nullptr, map.erase(1));
+  ASSERT_NE(nullptr, map.find(5));
+  EXPECT_EQ(5, map.find(5)->handle_);
+}
+
+TEST(StreamSlotMapTest, CollidingHandles) {
+  TestMap map(8);
+  map.insert(1, std::make_unique<TestValue>(1));
+  // Same slot as handle 1 while it is still live.
+  map.insert(9, std::make_unique<TestValue>(9));
+
+  ASSERT_NE(nullptr, map.find(1));
+  ASSERT_NE(nullptr, map.find(9));
+  EXPECT_EQ(9, map.find(9)->handle_);
+
+  // Erasing the slot occupant leaves the colliding value reachable.
+  EXPECT_NE(nullptr, map.erase(1));
+  ASSERT_NE(nullptr, map.find(9));
+  EXPECT_EQ(9, map.erase(9)->handle_);
+  EXPECT_EQ(0, map.size());
+}
+
+TEST(StreamSlotMapTest, Grow) {
+  TestMap map(2);
+  for (envoy_stream_t handle = 0; handle < 100; handle++) {
+    map.insert(handle, std::make_unique<TestValue>(handle));
+  }
+  EXPECT_EQ(100, map.size());
+  for (envoy_stream_t handle = 0; handle < 100; handle++) {
+    ASSERT_NE(nullptr, map.find(handle));
+    EXPECT_EQ(handle, map.find(handle)->handle_);
+  }
+  for (envoy_stream_t handle = 0; handle < 100; handle += 2) {
+    EXPECT_NE(nullptr, map.erase(handle));
+  }
+  EXPECT_EQ(50, map.size());
+  for (envoy_stream_t handle = 0; handle < 100; handle++) {
+    EXPECT_EQ(handle % 2 == 1, map.find(handle) != nullptr);
+  }
+}
+
+TEST(StreamSlotMapTest, StridedHandles) {
+  // Handles as one of four workers sees them: every fourth handle, all with the same low bits.
+  TestMap strided(64, 4);
+  TestMap unstrided(64);
+  for (envoy_stream_t handle = 3; handle < 3 + 4 * 32; handle += 4) {
+    strided.insert(handle, std::make_unique<TestValue>(handle));
+    unstrided.insert(handle, std::make_unique<TestValue>(handle));
+  }
+  EXPECT_EQ(32, strided.size());
+  EXPECT_EQ(0, strided.overflowSize());
+  // Without the stride only a quarter of the slots are reachable.
+  EXPECT_EQ(16, unstrided.overflowSize());
+
+  for (envoy_stream_t handle = 3; handle < 3 + 4 * 32; handle += 4) {
+    ASSERT_NE(nullptr, strided.find(handle));
+    EXPECT_EQ(handle, strided.find(handle)->handle_);
+  }
+  EXPECT_EQ(nullptr, strided.find(4));
+
+  // Growing keeps strided handles in their own slots.
+  for (envoy_stream_t handle = 3 + 4 * 32; handle < 3 + 4 * 100; handle += 4) {
+    strided.insert(handle, std::make_unique<TestValue>(handle));
+  }
+  EXPECT_EQ(100, strided.size());
+  EXPECT_EQ(0, strided.overflowSize());
+  for (envoy_stream_t handle = 3; handle < 3 + 4 * 100; handle += 4) {
+    EXPECT_EQ(handle, strided.erase(handle)->handle_);
+  }
+  EXPECT_EQ(0, strided.size());
+}
+
+} // namespace Http
+} // namespace Envoy
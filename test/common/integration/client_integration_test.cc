@@ -129,7 +129,7 @@ TEST_P(ClientIntegrationTest, Basic) {
   envoy_stream_t stream = 1;
   ConditionalInitializer terminal_callback;
   // Setup bridge_callbacks to handle the response.
-  envoy_http_callbacks bridge_callbacks;
+  envoy_http_callbacks bridge_callbacks{};
   callbacks_called cc = {0, 0, 0, 0, 0, &terminal_callback};
   bridge_callbacks.context = &cc;
   bridge_callbacks.on_headers = [](envoy_headers c_headers, bool end_stream,
@@ -152,7 +152,7 @@ TEST_P(ClientIntegrationTest, Basic) {
     c_data.release(c_data.context);
     return nullptr;
   };
-  bridge_callbacks.on_complete = [](void* context) -> void* {
+  bridge_callbacks.on_complete = [](envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_complete_calls++;
     cc->terminal_callback->setReady();
@@ -210,7 +210,7 @@ TEST_P(ClientIntegrationTest, BasicNon2xx) {
 
   envoy_stream_t stream = 1;
   // Setup bridge_callbacks to handle the response.
-  envoy_http_callbacks bridge_callbacks;
+  envoy_http_callbacks bridge_callbacks{};
   ConditionalInitializer terminal_callback;
   callbacks_called cc = {0, 0, 0, 0, 0, &terminal_callback};
   bridge_callbacks.context = &cc;
@@ -223,13 +223,13 @@ TEST_P(ClientIntegrationTest, BasicNon2xx) {
     cc->on_headers_calls++;
     return nullptr;
   };
-  bridge_callbacks.on_complete = [](void* context) -> void* {
+  bridge_callbacks.on_complete = [](envoy_stream_intel, void* context) -> void* {
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_complete_calls++;
     cc->terminal_callback->setReady();
     return nullptr;
   };
-  bridge_callbacks.on_error = [](envoy_error error, void* context) -> void* {
+  bridge_callbacks.on_error = [](envoy_error error, envoy_stream_intel, void* context) -> void* {
     error.message.release(error.message.context);
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_error_calls++;
@@ -269,7 +269,7 @@ TEST_P(ClientIntegrationTest, BasicReset) {
 
   envoy_stream_t stream = 1;
   // Setup bridge_callbacks to handle the response.
-  envoy_http_callbacks bridge_callbacks;
+  envoy_http_callbacks bridge_callbacks{};
   ConditionalInitializer terminal_callback;
   callbacks_called cc = {0, 0, 0, 0, 0, &terminal_callback};
   bridge_callbacks.context = &cc;
@@ -278,7 +278,7 @@ TEST_P(ClientIntegrationTest, BasicReset) {
     ADD_FAILURE() << "unexpected call to on_headers";
     return nullptr;
   };
-  bridge_callbacks.on_error = [](envoy_error error, void* context) -> void* {
+  bridge_callbacks.on_error = [](envoy_error error, envoy_stream_intel, void* context) -> void* {
     error.message.release(error.message.context);
     callbacks_called* cc = static_cast<callbacks_called*>(context);
     cc->on_error_calls++;
@@ -98,7 +98,7 @@ TEST(MainInterfaceTest, BasicStream) {
       nullptr /* on_metadata */,
       nullptr /* on_trailers */,
       nullptr /* on_error */,
-      [](void* context) -> void* {
+      [](envoy_stream_intel, void* context) -> void* {
         auto* on_complete_notification = static_cast<absl::Notification*>(context);
         on_complete_notification->Notify();
         return nullptr;
@@ -130,6 +130,82 @@ TEST(MainInterfaceTest, BasicStream) {
   ASSERT_TRUE(engine_cbs_context.on_exit.WaitForNotificationWithTimeout(absl::Seconds(10)));
 }
 
+TEST(MainInterfaceTest, SendRequest) {
+  const std::string config =
+      "{\"admin\":{},\"static_resources\":{\"listeners\":[{\"name\":\"base_api_listener\", "
+      "\"address\":{\"socket_address\":{\"protocol\":\"TCP\",\"address\":\"0.0.0.0\",\"port_"
+      "value\":10000}},\"api_listener\":{\"api_listener\":{\"@type\":\"type.googleapis.com/"
+      "envoy.extensions.filters.network.http_connection_manager.v3.HttpConnectionManager\",\"stat_"
+      "prefix\":\"hcm\",\"route_config\":{\"name\":\"api_router\",\"virtual_hosts\":[{\"name\":"
+      "\"api\",\"include_attempt_count_in_response\":true,\"domains\":[\"*\"],\"routes\":[{"
+      "\"match\":{\"prefix\":\"/"
+      // This config has the buffer filter which allows the test to exercise all of the send_*
+      // methods, and a direct response, which allows for simple stream completion.
+      "\"},\"direct_response\":{\"status\":\"200\"}}]}]},\"http_filters\":[{\"name\":\"buffer\","
+      "\"typed_config\":{\"@type\":\"type.googleapis.com/"
+      "envoy.extensions.filters.http.buffer.v3.Buffer\", \"max_request_bytes\": \"65000\"}}, "
+      "{\"name\":\"envoy.router\",\"typed_config\":{\"@type\":\"type.googleapis.com/"
+      "envoy.extensions.filters.http.router.v3.Router\"}}]}}}]},\"layered_runtime\":{\"layers\":[{"
+      "\"name\":\"static_layer_0\",\"static_layer\":{\"overload\":{\"global_downstream_max_"
+      "connections\":50000}}}]}}";
+  const std::string level = "debug";
+  engine_test_context engine_cbs_context{};
+  envoy_engine_callbacks engine_cbs{[](void* context) -> void {
+                                      auto* engine_running =
+                                          static_cast<engine_test_context*>(context);
+                                      engine_running->on_engine_running.Notify();
+                                    } /*on_engine_running*/,
+                                    [](void* context) -> void {
+                                      auto* exit = static_cast<engine_test_context*>(context);
+                                      exit->on_exit.Notify();
+                                    } /*on_exit*/,
+                                    &engine_cbs_context /*context*/};
+  init_engine(engine_cbs, {});
+  run_engine(0, config.c_str(), level.c_str());
+
+  ASSERT_TRUE(
+      engine_cbs_context.on_engine_running.WaitForNotificationWithTimeout(absl::Seconds(10)));
+
+  absl::Notification on_complete_notification;
+  envoy_http_callbacks stream_cbs{
+      [](envoy_headers c_headers, bool end_stream, void*) -> void* {
+        auto response_headers = toResponseHeaders(c_headers);
+        EXPECT_EQ(response_headers->Status()->value().getStringView(), "200");
+        EXPECT_TRUE(end_stream);
+        return nullptr;
+      } /* on_headers */,
+      nullptr /* on_data */,
+      nullptr /* on_metadata */,
+      nullptr /* on_trailers */,
+      nullptr /* on_error */,
+      [](envoy_stream_intel, void* context) -> void* {
+        auto* on_complete_notification = static_cast<absl::Notification*>(context);
+        on_complete_notification->Notify();
+        return nullptr;
+      } /* on_complete */,
+      nullptr /* on_cancel */,
+      &on_complete_notification /* context */};
+  Http::TestRequestHeaderMapImpl headers;
+  HttpTestUtility::addDefaultHeaders(headers);
+  envoy_headers c_headers = Http::Utility::toBridgeHeaders(headers);
+
+  Buffer::OwnedImpl request_data = Buffer::OwnedImpl("request body");
+  envoy_data c_data = Data::Utility::toBridgeData(request_data);
+
+  Http::TestRequestTrailerMapImpl trailers;
+  envoy_headers c_trailers = Http::Utility::toBridgeHeaders(trailers);
+
+  envoy_stream_t stream = init_stream(0);
+
+  send_request(stream, stream_cbs, c_headers, &c_data, &c_trailers);
+
+  ASSERT_TRUE(on_complete_notification.WaitForNotificationWithTimeout(absl::Seconds(10)));
+
+  terminate_engine(0);
+
+  ASSERT_TRUE(engine_cbs_context.on_exit.WaitForNotificationWithTimeout(absl::Seconds(10)));
+}
+
 TEST(MainInterfaceTest, SendMetadata) {
   engine_test_context engine_cbs_context{};
   envoy_engine_callbacks engine_cbs{[](void* context) -> void {
@@ -151,10 +227,14 @@ TEST(MainInterfaceTest, SendMetadata) {
   ASSERT_TRUE(
       engine_cbs_context.on_engine_running.WaitForNotificationWithTimeout(absl::Seconds(10)));
 
-  envoy_http_callbacks stream_cbs{nullptr /* on_headers */,  nullptr /* on_data */,
-                                  nullptr /* on_metadata */, nullptr /* on_trailers */,
-                                  nullptr /* on_error */,    nullptr /* on_complete */,
-                                  nullptr /* on_cancel */,   nullptr /* context */};
+  envoy_http_callbacks stream_cbs{nullptr /* on_headers */,
+                                  nullptr /* on_data */,
+                                  nullptr /* on_metadata */,
+                                  nullptr /* on_trailers */,
+                                  nullptr /* on_error */,
+                                  nullptr /* on_complete */,
+                                  nullptr /* on_cancel */,
+                                  nullptr /* context */};
 
   envoy_stream_t stream = init_stream(0);
 
@@ -195,7 +275,7 @@ TEST(MainInterfaceTest, ResetStream) {
                                   nullptr /* on_trailers */,
                                   nullptr /* on_error */,
                                   nullptr /* on_complete */,
-                                  [](void* context) -> void* {
+                                  [](envoy_stream_intel, void* context) -> void* {
                                     auto* on_cancel_notification =
                                         static_cast<absl::Notification*>(context);
                                     on_cancel_notification->Notify();
@@ -216,6 +296,87 @@ TEST(MainInterfaceTest, ResetStream) {
   ASSERT_TRUE(engine_cbs_context.on_exit.WaitForNotificationWithTimeout(absl::Seconds(10)));
 }
 
+TEST(MainInterfaceTest, RejectsMultipleWorkers) {
+  engine_test_context engine_cbs_context{};
+  envoy_engine_callbacks engine_cbs{[](void* context) -> void {
+                                      auto* engine_running =
+                                          static_cast<engine_test_context*>(context);
+                                      engine_running->on_engine_running.Notify();
+                                    } /*on_engine_running*/,
+                                    [](void* context) -> void {
+                                      auto* exit = static_cast<engine_test_context*>(context);
+                                      exit->on_exit.Notify();
+                                    } /*on_exit*/,
+                                    &engine_cbs_context /*context*/};
+
+  init_engine(engine_cbs, {});
+  // Workers would be separate Envoy servers sharing process-wide state.
+  EXPECT_EQ(ENVOY_FAILURE, set_engine_worker_count(0, 2));
+  EXPECT_EQ(ENVOY_FAILURE, set_engine_worker_count(0, 0));
+  ASSERT_EQ(ENVOY_SUCCESS, set_engine_worker_count(0, 1));
+  run_engine(0, MINIMAL_NOOP_CONFIG.c_str(), LEVEL_DEBUG.c_str());
+
+  ASSERT_TRUE(
+      engine_cbs_context.on_engine_running.WaitForNotificationWithTimeout(absl::Seconds(10)));
+  ASSERT_EQ(ENVOY_FAILURE, set_engine_worker_count(0, 1));
+
+  // Streams run on the single worker.
+  absl::Notification on_cancel_notifications[2];
+  for (auto& on_cancel_notification : on_cancel_notifications) {
+    envoy_http_callbacks stream_cbs{nullptr /* on_headers */,
+                                    nullptr /* on_data */,
+                                    nullptr /* on_metadata */,
+                                    nullptr /* on_trailers */,
+                                    nullptr /* on_error */,
+                                    nullptr /* on_complete */,
+                                    [](envoy_stream_intel, void* context) -> void* {
+                                      auto* on_cancel_notification =
+                                          static_cast<absl::Notification*>(context);
+                                      on_cancel_notification->Notify();
+                                      return nullptr;
+                                    } /* on_cancel */,
+                                    &on_cancel_notification /* context */};
+
+    envoy_stream_t stream = init_stream(0);
+    start_stream(stream, stream_cbs);
+    reset_stream(stream);
+  }
+
+  for (auto& on_cancel_notification : on_cancel_notifications) {
+    ASSERT_TRUE(on_cancel_notification.WaitForNotificationWithTimeout(absl::Seconds(10)));
+  }
+
+  terminate_engine(0);
+
+  ASSERT_TRUE(engine_cbs_context.on_exit.WaitForNotificationWithTimeout(absl::Seconds(10)));
+}
+
+TEST(MainInterfaceTest, FastStart) {
+  engine_test_context engine_cbs_context{};
+  envoy_engine_callbacks engine_cbs{[](void* context) -> void {
+                                      auto* engine_running =
+                                          static_cast<engine_test_context*>(context);
+                                      engine_running->on_engine_running.Notify();
+                                    } /*on_engine_running*/,
+                                    [](void* context) -> void {
+                                      auto* exit = static_cast<engine_test_context*>(context);
+                                      exit->on_exit.Notify();
+                                    } /*on_exit*/,
+                                    &engine_cbs_context /*context*/};
+
+  init_engine(engine_cbs, {});
+  ASSERT_EQ(ENVOY_SUCCESS, set_engine_fast_start(0, true));
+  run_engine(0, MINIMAL_NOOP_CONFIG.c_str(), LEVEL_DEBUG.c_str());
+
+  ASSERT_TRUE(
+      engine_cbs_context.on_engine_running.WaitForNotificationWithTimeout(absl::Seconds(10)));
+  ASSERT_EQ(ENVOY_FAILURE, set_engine_fast_start(0, false));
+
+  terminate_engine(0);
+
+  ASSERT_TRUE(engine_cbs_context.on_exit.WaitForNotificationWithTimeout(absl::Seconds(10)));
+}
+
 TEST(MainInterfaceTest, UsingMainInterfaceWithoutARunningEngine) {
 
   Http::TestRequestHeaderMapImpl headers;
@@ -266,25 +427,53 @@ TEST(MainInterfaceTest, RegisterPlatformApi) {
   ASSERT_TRUE(engine_cbs_context.on_exit.WaitForNotificationWithTimeout(absl::Seconds(10)));
 }
 
-TEST(MainInterfaceTest, InitEngineReturns1) {
-  // TODO(goaway): return new handle once multiple engine support is in place.
-  // https://github.com/lyft/envoy-mobile/issues/332
-  engine_test_context test_context{};
-  envoy_engine_callbacks engine_cbs{[](void* context) -> void {
-                                      auto* engine_running =
-                                          static_cast<engine_test_context*>(context);
-                                      engine_running->on_engine_running.Notify();
-                                    } /*on_engine_running*/,
-                                    [](void* context) -> void {
-                                      auto* exit = static_cast<engine_test_context*>(context);
-                                      exit->on_exit.Notify();
-                                    } /*on_exit*/,
-                                    &test_context /*context*/};
-  ASSERT_EQ(1, init_engine(engine_cbs, {}));
-  run_engine(0, MINIMAL_NOOP_CONFIG.c_str(), LEVEL_DEBUG.c_str());
-  ASSERT_TRUE(test_context.on_engine_running.WaitForNotificationWithTimeout(absl::Seconds(3)));
-  terminate_engine(0);
-  ASSERT_TRUE(test_context.on_exit.WaitForNotificationWithTimeout(absl::Seconds(3)));
+TEST(MainInterfaceTest, OneEngineAtATime) {
+  engine_test_context test_contexts[2]{};
+  envoy_engine_callbacks engine_cbs[2];
+  for (size_t i = 0; i < 2; i++) {
+    engine_cbs[i] = {[](void* context) -> void {
+                       auto* engine_running = static_cast<engine_test_context*>(context);
+                       engine_running->on_engine_running.Notify();
+                     } /*on_engine_running*/,
+                     [](void* context) -> void {
+                       auto* exit = static_cast<engine_test_context*>(context);
+                       exit->on_exit.Notify();
+                     } /*on_exit*/,
+                     &test_contexts[i] /*context*/};
+  }
+
+  const envoy_engine_t first = init_engine(engine_cbs[0], {});
+  ASSERT_GT(first, 0);
+  // A second engine would be another Envoy server sharing process-wide state.
+  ASSERT_EQ(-1, init_engine(engine_cbs[1], {}));
+
+  // The rejection addresses no engine, rather than falling back to the live one.
+  EXPECT_EQ(ENVOY_FAILURE, set_engine_worker_count(-1, 1));
+  EXPECT_EQ(ENVOY_FAILURE, run_engine(-1, MINIMAL_NOOP_CONFIG.c_str(), LEVEL_DEBUG.c_str()));
+  EXPECT_EQ(0, init_stream(-1));
+  EXPECT_EQ(ENVOY_FAILURE, record_counter_inc(-1, "counter", envoy_stats_notags, 1));
+
+  run_engine(first, MINIMAL_NOOP_CONFIG.c_str(), LEVEL_DEBUG.c_str());
+  ASSERT_TRUE(test_contexts[0].on_engine_running.WaitForNotificationWithTimeout(absl::Seconds(10)));
+  const envoy_stream_t first_stream = init_stream(first);
+  ASSERT_NE(0, first_stream);
+
+  terminate_engine(first);
+  ASSERT_TRUE(test_contexts[0].on_exit.WaitForNotificationWithTimeout(absl::Seconds(10)));
+  EXPECT_EQ(ENVOY_FAILURE, record_counter_inc(first, "counter", envoy_stats_notags, 1));
+  EXPECT_EQ(0, init_stream(first));
+
+  // Once terminated, the handle is handed out again and its stream numbering carries on, so that
+  // stale stream handles do not address the new engine's streams.
+  const envoy_engine_t second = init_engine(engine_cbs[1], {});
+  ASSERT_EQ(first, second);
+  run_engine(second, MINIMAL_NOOP_CONFIG.c_str(), LEVEL_DEBUG.c_str());
+  ASSERT_TRUE(test_contexts[1].on_engine_running.WaitForNotificationWithTimeout(absl::Seconds(10)));
+  EXPECT_NE(first_stream, init_stream(second));
+  EXPECT_EQ(ENVOY_SUCCESS, record_counter_inc(second, "counter", envoy_stats_notags, 1));
+
+  terminate_engine(second);
+  ASSERT_TRUE(test_contexts[1].on_exit.WaitForNotificationWithTimeout(absl::Seconds(10)));
 }
 
 TEST(MainInterfaceTest, PreferredNetwork) {
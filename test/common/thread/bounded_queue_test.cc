@@ -0,0 +1,85 @@
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "library/common/thread/bounded_queue.h"
+
+namespace Envoy {
+namespace Thread {
+
+TEST(BoundedQueueTest, FifoAndCapacity) {
+  BoundedQueue<int> queue(4);
+  EXPECT_EQ(queue.capacity(), 4);
+  EXPECT_TRUE(queue.empty());
+
+  int value;
+  EXPECT_FALSE(queue.pop(value));
+  for (int i = 0; i < 4; i++) {
+    EXPECT_TRUE(queue.push(i));
+  }
+  int overflow = 4;
+  EXPECT_FALSE(queue.push(overflow));
+  EXPECT_FALSE(queue.empty());
+
+  for (int i = 0; i < 4; i++) {
+    ASSERT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(queue.pop(value));
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(BoundedQueueTest, FailedPushLeavesValue) {
+  BoundedQueue<std::unique_ptr<int>> queue(2);
+  auto first = std::make_unique<int>(1);
+  auto second = std::make_unique<int>(2);
+  auto third = std::make_unique<int>(3);
+  EXPECT_TRUE(queue.push(first));
+  EXPECT_TRUE(queue.push(second));
+  EXPECT_EQ(first, nullptr);
+  EXPECT_FALSE(queue.push(third));
+  ASSERT_NE(third, nullptr);
+  EXPECT_EQ(*third, 3);
+}
+
+TEST(BoundedQueueTest, ConcurrentProducers) {
+  constexpr int Producers = 4;
+  constexpr int PerProducer = 10000;
+  BoundedQueue<int> queue(64);
+
+  std::vector<std::thread> producers;
+  for (int p = 0; p < Producers; p++) {
+    producers.emplace_back([&queue, p]() {
+      for (int i = 0; i < PerProducer; i++) {
+        int value = p * PerProducer + i;
+        while (!queue.push(value)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  // Each producer's values must arrive in the order it pushed them.
+  std::vector<int> next(Producers, 0);
+  int received = 0;
+  while (received < Producers * PerProducer) {
+    int value;
+    if (!queue.pop(value)) {
+      std::this_thread::yield();
+      continue;
+    }
+    const int producer = value / PerProducer;
+    ASSERT_EQ(value % PerProducer, next[producer]);
+    next[producer]++;
+    received++;
+  }
+
+  for (std::thread& producer : producers) {
+    producer.join();
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+} // namespace Thread
+} // namespace Envoy
@@ -0,0 +1,305 @@
+// Microbenchmarks for the conversions performed when data crosses the platform bridge.
+//
+// In addition to time per operation, each benchmark reports the heap allocations made by the
+// measured conversion (allocs/op) on glibc builds without tcmalloc or a sanitizer, where this
+// binary interposes malloc to count them. Input construction happens with timing paused and is
+// excluded from both measurements.
+
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "common/buffer/buffer_impl.h"
+#include "common/http/header_map_impl.h"
+#include "common/stats/symbol_table_impl.h"
+
+#include "benchmark/benchmark.h"
+#include "library/cc/bridge_utility.h"
+#include "library/common/data/utility.h"
+#include "library/common/http/header_utility.h"
+#include "library/common/stats/utility.h"
+#include "library/common/types/c_types.h"
+
+namespace {
+std::atomic<uint64_t> allocations{0};
+} // namespace
+
+// Replacing malloc collides with the allocators that tcmalloc and the sanitizers install, so
+// allocations are only counted in plain glibc builds.
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer) ||                         \
+    __has_feature(memory_sanitizer)
+#define ALLOCATOR_REPLACED
+#endif
+#endif
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__) ||                               \
+    defined(ADDRESS_SANITIZER) || defined(THREAD_SANITIZER) || defined(TCMALLOC) ||                \
+    defined(GPERFTOOLS_TCMALLOC)
+#define ALLOCATOR_REPLACED
+#endif
+#if defined(__GLIBC__) && !defined(ALLOCATOR_REPLACED)
+#define COUNT_ALLOCATIONS
+#endif
+
+#ifdef COUNT_ALLOCATIONS
+// glibc lets a program replace malloc by defining it, and exports its own implementation under
+// __libc_* names to forward to. This catches both operator new, which allocates through malloc,
+// and the bridge's direct malloc calls. free is left to glibc, which owns every block.
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+
+void* malloc(size_t size) noexcept {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) noexcept {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) noexcept {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_realloc(ptr, size);
+}
+
+// Aligned operator new allocates through these.
+void* memalign(size_t alignment, size_t size) noexcept {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_memalign(alignment, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size) noexcept {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** ptr, size_t alignment, size_t size) noexcept {
+  if (alignment % sizeof(void*) != 0 || (alignment & (alignment - 1)) != 0) {
+    return EINVAL;
+  }
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  void* block = __libc_memalign(alignment, size);
+  if (block == nullptr) {
+    return ENOMEM;
+  }
+  *ptr = block;
+  return 0;
+}
+}
+#endif
+
+namespace Envoy {
+namespace {
+
+// Counts heap allocations made while running the measured section of a benchmark, and reports them
+// per iteration when destroyed.
+class AllocationCounter {
+public:
+  AllocationCounter(benchmark::State& state) : state_(state) {}
+
+  ~AllocationCounter() {
+#ifdef COUNT_ALLOCATIONS
+    state_.counters["allocs/op"] =
+        benchmark::Counter(static_cast<double>(total_), benchmark::Counter::kAvgIterations);
+#endif
+  }
+
+  // Brackets the measured section of a single iteration.
+  void start() { start_ = allocations.load(std::memory_order_relaxed); }
+  void stop() { total_ += allocations.load(std::memory_order_relaxed) - start_; }
+
+private:
+  benchmark::State& state_;
+  uint64_t start_{};
+  uint64_t total_{};
+};
+
+// Request headers typical of a mobile API call, padded with custom headers up to count.
+std::vector<std::pair<std::string, std::string>> requestHeaders(size_t count) {
+  std::vector<std::pair<std::string, std::string>> headers = {
+      {":method", "POST"},
+      {":scheme", "https"},
+      {":authority", "api.example.com"},
+      {":path", "/v1/rides/estimate?lat=37.7749&lng=-122.4194"},
+      {"content-type", "application/json"},
+      {"accept-encoding", "gzip, deflate"},
+      {"user-agent", "example-app/1.0 (iOS 14.4)"},
+      {"x-request-id", "7a9c3b2e-4f1d-4c7a-9e6b-2d8f1a0c5b3e"},
+  };
+  for (size_t i = headers.size(); i < count; i++) {
+    headers.push_back(
+        {"x-custom-header-" + std::to_string(i), "custom-value-" + std::to_string(i)});
+  }
+  headers.resize(count);
+  return headers;
+}
+
+envoy_headers toEnvoyHeaders(const std::vector<std::pair<std::string, std::string>>& headers) {
+  envoy_map_entry* entries =
+      static_cast<envoy_map_entry*>(safe_malloc(sizeof(envoy_map_entry) * headers.size()));
+  for (size_t i = 0; i < headers.size(); i++) {
+    entries[i] = {Data::Utility::copyToBridgeData(headers[i].first),
+                  Data::Utility::copyToBridgeData(headers[i].second)};
+  }
+  return {static_cast<envoy_map_size_t>(headers.size()), entries};
+}
+
+// Payload sizes ranging from a small JSON response to a large download chunk.
+void payloadSizes(benchmark::internal::Benchmark* b) {
+  for (int64_t size : {64, 1024, 16 * 1024, 256 * 1024}) {
+    b->Arg(size);
+  }
+}
+
+void headerCounts(benchmark::internal::Benchmark* b) {
+  for (int64_t count : {4, 8, 16, 32}) {
+    b->Arg(count);
+  }
+}
+
+} // namespace
+
+static void bmToBridgeData(benchmark::State& state) {
+  const std::string payload(state.range(0), 'a');
+  AllocationCounter counter(state);
+  for (auto _ : state) {
+    state.PauseTiming();
+    Buffer::OwnedImpl buffer(payload);
+    state.ResumeTiming();
+
+    counter.start();
+    envoy_data data = Data::Utility::toBridgeData(buffer);
+    counter.stop();
+
+    benchmark::DoNotOptimize(data.bytes);
+    data.release(data.context);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(bmToBridgeData)->Apply(payloadSizes);
+
+static void bmCopyToBridgeData(benchmark::State& state) {
+  const std::string payload(state.range(0), 'a');
+  AllocationCounter counter(state);
+  for (auto _ : state) {
+    counter.start();
+    envoy_data data = Data::Utility::copyToBridgeData(payload);
+    counter.stop();
+
+    benchmark::DoNotOptimize(data.bytes);
+    data.release(data.context);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(bmCopyToBridgeData)->Apply(payloadSizes);
+
+static void bmToRequestHeaders(benchmark::State& state) {
+  const auto headers = requestHeaders(state.range(0));
+  AllocationCounter counter(state);
+  for (auto _ : state) {
+    state.PauseTiming();
+    envoy_headers c_headers = toEnvoyHeaders(headers);
+    state.ResumeTiming();
+
+    counter.start();
+    Http::RequestHeaderMapPtr cpp_headers = Http::Utility::toRequestHeaders(c_headers);
+    counter.stop();
+
+    benchmark::DoNotOptimize(cpp_headers.get());
+
+    state.PauseTiming();
+    cpp_headers.reset();
+    state.ResumeTiming();
+  }
+}
+BENCHMARK(bmToRequestHeaders)->Apply(headerCounts);
+
+static void bmToBridgeHeaders(benchmark::State& state) {
+  Http::RequestHeaderMapPtr cpp_headers = Http::RequestHeaderMapImpl::create();
+  for (const auto& header : requestHeaders(state.range(0))) {
+    cpp_headers->addCopy(Http::LowerCaseString(header.first), header.second);
+  }
+  AllocationCounter counter(state);
+  for (auto _ : state) {
+    counter.start();
+    envoy_headers c_headers = Http::Utility::toBridgeHeaders(*cpp_headers);
+    counter.stop();
+
+    benchmark::DoNotOptimize(c_headers.entries);
+    release_envoy_headers(c_headers);
+  }
+}
+BENCHMARK(bmToBridgeHeaders)->Apply(headerCounts);
+
+static void bmRawHeaderMapAsEnvoyHeaders(benchmark::State& state) {
+  Platform::RawHeaderMap raw_headers;
+  for (const auto& header : requestHeaders(state.range(0))) {
+    raw_headers[header.first].push_back(header.second);
+  }
+  AllocationCounter counter(state);
+  for (auto _ : state) {
+    counter.start();
+    envoy_headers c_headers = Platform::rawHeaderMapAsEnvoyHeaders(raw_headers);
+    counter.stop();
+
+    benchmark::DoNotOptimize(c_headers.entries);
+    release_envoy_headers(c_headers);
+  }
+}
+BENCHMARK(bmRawHeaderMapAsEnvoyHeaders)->Apply(headerCounts);
+
+static void bmEnvoyHeadersAsRawHeaderMap(benchmark::State& state) {
+  const auto headers = requestHeaders(state.range(0));
+  AllocationCounter counter(state);
+  for (auto _ : state) {
+    state.PauseTiming();
+    envoy_headers c_headers = toEnvoyHeaders(headers);
+    state.ResumeTiming();
+
+    counter.start();
+    Platform::RawHeaderMap raw_headers = Platform::envoyHeadersAsRawHeaderMap(c_headers);
+    counter.stop();
+
+    benchmark::DoNotOptimize(raw_headers.size());
+
+    state.PauseTiming();
+    raw_headers.clear();
+    state.ResumeTiming();
+  }
+}
+BENCHMARK(bmEnvoyHeadersAsRawHeaderMap)->Apply(headerCounts);
+
+static void bmTransformToStatNameTagVector(benchmark::State& state) {
+  std::vector<std::pair<std::string, std::string>> tags;
+  for (int64_t i = 0; i < state.range(0); i++) {
+    tags.push_back({"tag-" + std::to_string(i), "value-" + std::to_string(i % 4)});
+  }
+  Stats::SymbolTableImpl symbol_table;
+  Stats::StatNameSetPtr stat_name_set = symbol_table.makeSet("pulse");
+  AllocationCounter counter(state);
+  for (auto _ : state) {
+    state.PauseTiming();
+    envoy_stats_tags c_tags = toEnvoyHeaders(tags);
+    state.ResumeTiming();
+
+    counter.start();
+    Stats::StatNameTagVector transformed =
+        Stats::Utility::transformToStatNameTagVector(c_tags, stat_name_set);
+    counter.stop();
+
+    benchmark::DoNotOptimize(transformed.data());
+
+    state.PauseTiming();
+    transformed = {};
+    state.ResumeTiming();
+  }
+}
+BENCHMARK(bmTransformToStatNameTagVector)->Arg(1)->Arg(4)->Arg(8);
+
+} // namespace Envoy
@@ -76,9 +76,9 @@ class TestSendHeaders(unittest.TestCase):
 #            # unused:
 #            # .set_on_metadata(on_metadata)
 #            # .set_on_trailers(on_trailers)
-#            .set_on_complete(lambda: stream_complete.set())
-#            .set_on_error(lambda _: stream_complete.set())
-#            .set_on_cancel(lambda: stream_complete.set())
+#            .set_on_complete(lambda _: stream_complete.set())
+#            .set_on_error(lambda _, __: stream_complete.set())
+#            .set_on_cancel(lambda _: stream_complete.set())
 #            .start()
 #        )
 #        stream.send_headers(